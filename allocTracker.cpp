@@ -0,0 +1,263 @@
+/***********************************************************************
+ * Source File:
+ *    Alloc Tracker : count the heap allocations made every frame
+ * Summary:
+ *    The replacement operator new puts a small header in front of every
+ *    block holding its size, so operator delete knows how much is going
+ *    away.  Nothing in here may allocate or we would count ourselves.
+ ************************************************************************/
+
+#include <cstdlib>    // for malloc() and free()
+#include <cstddef>    // for max_align_t
+#include <new>        // for bad_alloc and nothrow_t
+#include <atomic>
+#include <cstring>    // for strcmp()
+#include "allocTracker.h"
+
+using namespace std;
+
+AllocStats AllocTracker::lastFrame        = { 0, 0, 0, 0 };
+AllocStats AllocTracker::frameStart       = { 0, 0, 0, 0 };
+long long  AllocTracker::budget           = -1;
+bool       AllocTracker::fAbortOverBudget = false;
+long long  AllocTracker::frames           = 0;
+long long  AllocTracker::overBudgetFrames = 0;
+
+#ifdef ALLOC_TRACKER
+
+#define ALLOC_HEADER alignof(max_align_t)   // keeps the block aligned
+
+static atomic<long long> totalAllocations;
+static atomic<long long> totalFrees;
+static atomic<long long> totalBytes;
+static atomic<long long> tagAllocations[ALLOC_TAG_COUNT];
+static atomic<long long> tagBytes[ALLOC_TAG_COUNT];
+static long long         tagFrameStart[ALLOC_TAG_COUNT];
+static long long         tagLastFrame[ALLOC_TAG_COUNT];
+static const char *      tagNames[ALLOC_TAG_COUNT] = { "(untagged)" };
+static atomic<int>       tagCount(1);
+static thread_local int  currentTag = 0;
+
+/******************************************************************
+ * TRACKED ALLOCATE
+ * Get the memory from malloc() with room for our header in front
+ ****************************************************************/
+static void * trackedAllocate(size_t size)
+{
+   char * block = (char *)malloc(size + ALLOC_HEADER);
+   if (block == NULL)
+      return NULL;
+   *(size_t *)block = size;
+
+   totalAllocations.fetch_add(1, memory_order_relaxed);
+   totalBytes.fetch_add((long long)size, memory_order_relaxed);
+   tagAllocations[currentTag].fetch_add(1, memory_order_relaxed);
+   tagBytes[currentTag].fetch_add((long long)size, memory_order_relaxed);
+
+   return block + ALLOC_HEADER;
+}
+
+/******************************************************************
+ * TRACKED FREE
+ * Hand the block, header and all, back to free()
+ ****************************************************************/
+static void trackedFree(void * p)
+{
+   if (p == NULL)
+      return;
+   totalFrees.fetch_add(1, memory_order_relaxed);
+   free((char *)p - ALLOC_HEADER);
+}
+
+/******************************************************************
+ * OPERATOR NEW and DELETE
+ * Every flavor that ends up in trackedAllocate() or trackedFree()
+ ****************************************************************/
+void * operator new(size_t size)
+{
+   void * p = trackedAllocate(size);
+   if (p == NULL)
+      throw bad_alloc();
+   return p;
+}
+
+void * operator new[](size_t size)
+{
+   return operator new(size);
+}
+
+void * operator new(size_t size, const nothrow_t &) noexcept
+{
+   return trackedAllocate(size);
+}
+
+void * operator new[](size_t size, const nothrow_t &) noexcept
+{
+   return trackedAllocate(size);
+}
+
+void operator delete(void * p) noexcept                          { trackedFree(p); }
+void operator delete[](void * p) noexcept                        { trackedFree(p); }
+void operator delete(void * p, size_t) noexcept                  { trackedFree(p); }
+void operator delete[](void * p, size_t) noexcept                { trackedFree(p); }
+void operator delete(void * p, const nothrow_t &) noexcept       { trackedFree(p); }
+void operator delete[](void * p, const nothrow_t &) noexcept     { trackedFree(p); }
+
+/******************************************************************
+ * ALLOC SCOPE : CONSTRUCTOR and DESTRUCTOR
+ * Make the tag current on this thread, then put the old one back
+ ****************************************************************/
+AllocScope::AllocScope(int tag) : previous(currentTag)
+{
+   currentTag = tag;
+}
+
+AllocScope::~AllocScope()
+{
+   currentTag = previous;
+}
+
+#endif // ALLOC_TRACKER
+
+/******************************************************************
+ * ALLOC TRACKER : IS ENABLED
+ ****************************************************************/
+bool AllocTracker::isEnabled()
+{
+#ifdef ALLOC_TRACKER
+   return true;
+#else
+   return false;
+#endif
+}
+
+/******************************************************************
+ * ALLOC TRACKER : GET TOTAL
+ * Everything since the program started
+ ****************************************************************/
+AllocStats AllocTracker::getTotal()
+{
+   AllocStats stats = { 0, 0, 0, 0 };
+#ifdef ALLOC_TRACKER
+   stats.allocations = totalAllocations.load(memory_order_relaxed);
+   stats.frees       = totalFrees.load(memory_order_relaxed);
+   stats.bytes       = totalBytes.load(memory_order_relaxed);
+   stats.live        = stats.allocations - stats.frees;
+#endif
+   return stats;
+}
+
+/******************************************************************
+ * ALLOC TRACKER : REGISTER TAG
+ * Find the slot for a call site, adding it if this is the first time.
+ * Once we run out of slots everything else is untagged.
+ *   INPUT  name      what to call it in the report
+ *   OUTPUT <return>  the tag to give to AllocScope
+ ****************************************************************/
+int AllocTracker::registerTag(const char * name)
+{
+#ifdef ALLOC_TRACKER
+   int count = tagCount.load();
+   for (int i = 1; i < count; i++)
+      if (strcmp(tagNames[i], name) == 0)
+         return i;
+
+   if (count == ALLOC_TAG_COUNT)
+      return 0;
+   tagNames[count] = name;
+   tagCount.store(count + 1);
+   return count;
+#else
+   (void)name;
+   return 0;
+#endif
+}
+
+/******************************************************************
+ * ALLOC TRACKER : BEGIN FRAME
+ * Remember where the counters stand
+ ****************************************************************/
+void AllocTracker::beginFrame()
+{
+#ifdef ALLOC_TRACKER
+   frameStart = getTotal();
+   for (int i = 0; i < ALLOC_TAG_COUNT; i++)
+      tagFrameStart[i] = tagAllocations[i].load(memory_order_relaxed);
+#endif
+}
+
+/******************************************************************
+ * ALLOC TRACKER : END FRAME
+ * Work out what this frame did and hold it up against the budget.
+ * The first few frames are allowed to allocate while things warm up.
+ ****************************************************************/
+void AllocTracker::endFrame()
+{
+#ifdef ALLOC_TRACKER
+   AllocStats now = getTotal();
+   lastFrame.allocations = now.allocations - frameStart.allocations;
+   lastFrame.frees       = now.frees       - frameStart.frees;
+   lastFrame.bytes       = now.bytes       - frameStart.bytes;
+   lastFrame.live        = now.live;
+   for (int i = 0; i < ALLOC_TAG_COUNT; i++)
+      tagLastFrame[i] = tagAllocations[i].load(memory_order_relaxed) -
+                        tagFrameStart[i];
+
+   frames++;
+   if (budget >= 0 && frames > ALLOC_WARMUP_FRAMES &&
+       lastFrame.allocations > budget)
+   {
+      overBudgetFrames++;
+      if (fAbortOverBudget)
+      {
+         cerr << "Frame " << frames << " made " << lastFrame.allocations
+              << " allocations, the budget is " << budget << endl;
+         report(cerr);
+         abort();
+      }
+   }
+#endif
+}
+
+/******************************************************************
+ * ALLOC TRACKER : SET BUDGET
+ *   INPUT  allocationsPerFrame  most allocations a frame may make
+ *          fAbort               stop the program on the first failure
+ ****************************************************************/
+void AllocTracker::setBudget(long long allocationsPerFrame, bool fAbort)
+{
+   budget = allocationsPerFrame;
+   fAbortOverBudget = fAbort;
+}
+
+/******************************************************************
+ * ALLOC TRACKER : REPORT
+ * Totals, the last frame, and a line for every call-site tag
+ ****************************************************************/
+void AllocTracker::report(ostream & out)
+{
+   if (!isEnabled())
+   {
+      out << "Allocation tracking is off.  Build with -DALLOC_TRACKER\n";
+      return;
+   }
+
+   AllocStats total = getTotal();
+   out << "Allocations: " << total.allocations
+       << " (" << total.bytes << " bytes), "
+       << total.frees << " frees, " << total.live << " live\n"
+       << "Last frame:  " << lastFrame.allocations
+       << " (" << lastFrame.bytes << " bytes), "
+       << lastFrame.frees << " frees\n"
+       << "Frames:      " << frames << ", "
+       << overBudgetFrames << " over budget\n";
+
+#ifdef ALLOC_TRACKER
+   int count = tagCount.load();
+   for (int i = 0; i < count; i++)
+      out << "   " << tagNames[i] << ": "
+          << tagAllocations[i].load() << " allocations, "
+          << tagBytes[i].load() << " bytes, "
+          << tagLastFrame[i] << " last frame\n";
+#endif
+}
@@ -0,0 +1,109 @@
+/***********************************************************************
+ * Header File:
+ *    Alloc Tracker : count the heap allocations made every frame
+ * Summary:
+ *    When built with -DALLOC_TRACKER the global operator new and delete
+ *    are replaced so every allocation is counted: how many, how many
+ *    bytes and how many are still alive.  Allocations are also charged
+ *    to whatever ALLOC_SCOPE() tag is active so we can see who is doing
+ *    it.  Without the flag everything here compiles down to nothing.
+ ************************************************************************/
+
+#ifndef ALLOC_TRACKER_H
+#define ALLOC_TRACKER_H
+
+#include <iostream>
+
+#define ALLOC_TAG_COUNT      32   // distinct call-site tags we keep apart
+#define ALLOC_WARMUP_FRAMES  60   // frames before the budget is enforced
+
+/*********************************************
+ * ALLOC STATS
+ * Counters for one frame or for the whole run
+ *********************************************/
+struct AllocStats
+{
+   long long allocations;   // calls to operator new
+   long long frees;         // calls to operator delete
+   long long bytes;         // bytes asked for
+   long long live;          // allocations not yet freed
+};
+
+/*********************************************
+ * ALLOC TRACKER
+ * All the counters are global, just like the
+ * heap they are counting.
+ *********************************************/
+class AllocTracker
+{
+public:
+   // was the tracker compiled in?
+   static bool isEnabled();
+
+   // bracket one frame of work
+   static void beginFrame();
+   static void endFrame();
+
+   // more than this many allocations in a steady-state frame is a
+   // failure.  A negative budget turns the check off.  If fAbort is set
+   // the first failure prints a report and stops the program
+   static void setBudget(long long allocationsPerFrame, bool fAbort);
+   static bool isOverBudget()           { return overBudgetFrames > 0; }
+   static long long getOverBudgetFrames() { return overBudgetFrames;   }
+
+   // what happened during the last complete frame, and overall
+   static AllocStats getFrame() { return lastFrame; }
+   static AllocStats getTotal();
+
+   // name a call site.  Returns the tag to hand to AllocScope
+   static int registerTag(const char * name);
+
+   // print everything we know
+   static void report(std::ostream & out);
+
+private:
+   static AllocStats lastFrame;          // the frame that just finished
+   static AllocStats frameStart;         // totals when this frame began
+   static long long  budget;             // allowed allocations per frame
+   static bool       fAbortOverBudget;   // stop at the first failure?
+   static long long  frames;             // frames seen so far
+   static long long  overBudgetFrames;   // frames that broke the budget
+};
+
+/*********************************************
+ * ALLOC SCOPE
+ * While one of these is alive, allocations on
+ * this thread are charged to its tag
+ *********************************************/
+class AllocScope
+{
+public:
+#ifdef ALLOC_TRACKER
+   AllocScope(int tag);
+   ~AllocScope();
+private:
+   int previous;
+#else
+   AllocScope(int) {}
+#endif
+};
+
+#define ALLOC_SCOPE_JOIN(a, b) a##b
+#define ALLOC_SCOPE_NAME(a, b) ALLOC_SCOPE_JOIN(a, b)
+
+/*********************************************
+ * ALLOC SCOPE
+ * Charge the rest of this block to a named tag:
+ *    ALLOC_SCOPE("createDebris");
+ *********************************************/
+#ifdef ALLOC_TRACKER
+#define ALLOC_SCOPE(name)                                                  \
+   static const int ALLOC_SCOPE_NAME(allocTag, __LINE__) =                 \
+      AllocTracker::registerTag(name);                                     \
+   AllocScope ALLOC_SCOPE_NAME(allocScope, __LINE__)(                      \
+      ALLOC_SCOPE_NAME(allocTag, __LINE__))
+#else
+#define ALLOC_SCOPE(name)
+#endif
+
+#endif // ALLOC_TRACKER_H
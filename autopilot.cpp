@@ -0,0 +1,223 @@
+/***********************************************************************
+ * Source File:
+ *    Autopilot : a player that never gets tired
+ * Summary:
+ *    Each tick has two questions.  Is a rock going to hit us soon?
+ *    Look at every rock near the ship, work out when it passes closest
+ *    and how close that is, and run from the soonest one that passes
+ *    too close.  If not, find the nearest rock in the grid, work out
+ *    where a bullet fired now would meet it, and line up on that spot.
+ ************************************************************************/
+
+#include <cmath>
+#include "autopilot.h"
+#include "game.h"
+
+#define AUTOPILOT_THREAT_RANGE   120.0   // how far to look for danger
+#define AUTOPILOT_THREAT_TICKS   30.0    // how far ahead to look
+#define AUTOPILOT_SAFETY         6.0     // room to spare when passing
+#define AUTOPILOT_TARGET_RANGE   2000.0  // how far to look for a target
+#define AUTOPILOT_BULLET_SPEED   5.0     // a new Bullet's own speed
+#define AUTOPILOT_BULLET_LIFE    40.0    // ticks before a bullet dies
+#define AUTOPILOT_THRUST_ANGLE   60.0    // close enough to thrust away
+
+/******************************************************************
+ * HEADING OF
+ * Which way a vector points, in degrees, counterclockwise from +x
+ ****************************************************************/
+static float headingOf(float dx, float dy)
+{
+   return (float)(atan2(dy, dx) * 180.0 / PI);
+}
+
+/******************************************************************
+ * ROCK VELOCITY
+ * How far a rock moves each tick.  Rocks scale their velocity by
+ * their angle (see Rocks::globalAdvance())
+ ****************************************************************/
+static void rockVelocity(const Rocks & rock, float & dx, float & dy)
+{
+   dx = (float)(rock.getVelocity().getDx() * cos((rock.getAngle() + 90) * PI / 180));
+   dy = (float)(rock.getVelocity().getDy() * sin((rock.getAngle() + 90) * PI / 180));
+}
+
+/******************************************************************
+ * AUTOPILOT : CONSTRUCTOR
+ ****************************************************************/
+Autopilot::Autopilot(int difficulty, int aggression) :
+   difficulty(difficulty), aggression(aggression), deadTicks(0), coolDown(0)
+{
+   if (this->difficulty < 0)
+      this->difficulty = 0;
+   if (this->difficulty > AUTOPILOT_KNOB_MAX)
+      this->difficulty = AUTOPILOT_KNOB_MAX;
+   if (this->aggression < 0)
+      this->aggression = 0;
+   if (this->aggression > AUTOPILOT_KNOB_MAX)
+      this->aggression = AUTOPILOT_KNOB_MAX;
+}
+
+/******************************************************************
+ * AUTOPILOT : DECIDE
+ *   INPUT  game      where everything is
+ *          player    whose ship we are flying
+ *   OUTPUT <return>  the INPUT_* keys to hold this tick
+ ****************************************************************/
+int Autopilot::decide(const Game & game, int player)
+{
+   const Ship & ship = game.getShip(player);
+   if (coolDown > 0)
+      coolDown--;
+
+   // wait a moment, less on harder settings, then come back
+   if (!ship.isAlive())
+   {
+      deadTicks++;
+      return deadTicks > (AUTOPILOT_KNOB_MAX - difficulty) * 6 ? INPUT_DOWN : 0;
+   }
+   deadTicks = 0;
+
+   float x  = ship.getPosition().getX();
+   float y  = ship.getPosition().getY();
+   float vx = ship.getVelocity().getDx();
+   float vy = ship.getVelocity().getDy();
+
+   // the rock that will pass too close the soonest
+   const Rocks * pThreat = NULL;
+   float soonest = AUTOPILOT_THREAT_TICKS;
+   auto checkThreat = [&](Rocks * pRock)
+   {
+      if (!pRock->isAlive())
+         return;
+      float rdx, rdy;
+      rockVelocity(*pRock, rdx, rdy);
+      float dx = pRock->getPosition().getX() - x;
+      float dy = pRock->getPosition().getY() - y;
+      float wx = rdx - vx;
+      float wy = rdy - vy;
+      float ww = wx * wx + wy * wy;
+      float t  = ww > 0.0 ? -(dx * wx + dy * wy) / ww : 0.0;
+      if (t < 0.0)
+         t = 0.0;
+      if (t > soonest)
+         return;
+      float cx = dx + wx * t;
+      float cy = dy + wy * t;
+      float tooClose = ship.getSize() + pRock->getSize() + AUTOPILOT_SAFETY;
+      if (cx * cx + cy * cy < tooClose * tooClose)
+      {
+         soonest = t;
+         pThreat = pRock;
+      }
+   };
+   game.getRockGrid().query(x - AUTOPILOT_THREAT_RANGE, y - AUTOPILOT_THREAT_RANGE,
+                            x + AUTOPILOT_THREAT_RANGE, y + AUTOPILOT_THREAT_RANGE,
+                            checkThreat);
+   if (pThreat)
+      return evade(ship, *pThreat);
+
+   // otherwise go after the nearest rock
+   auto distance = [x, y](Rocks * pRock)
+   {
+      if (!pRock->isAlive())
+         return (float)(AUTOPILOT_TARGET_RANGE * 2.0);
+      float dx = pRock->getPosition().getX() - x;
+      float dy = pRock->getPosition().getY() - y;
+      return (float)sqrt(dx * dx + dy * dy);
+   };
+   Rocks * pTarget = NULL;
+   if (game.getRockGrid().nearest(ship.getPosition(), AUTOPILOT_TARGET_RANGE,
+                                  distance, pTarget))
+      return attack(ship, *pTarget);
+   return 0;
+}
+
+/******************************************************************
+ * AUTOPILOT : STEER
+ * Turn toward a heading, unless we are already within half a turn
+ *   INPUT  heading   which way the ship points, degrees
+ *          desired   which way it should
+ *   OUTPUT <return>  INPUT_LEFT, INPUT_RIGHT or nothing
+ ****************************************************************/
+int Autopilot::steer(float heading, float desired) const
+{
+   float diff = fmod(desired - heading + 540.0, 360.0) - 180.0;
+   if (diff > ROTATE_AMOUNT / 2.0)
+      return INPUT_LEFT;
+   if (diff < -ROTATE_AMOUNT / 2.0)
+      return INPUT_RIGHT;
+   return 0;
+}
+
+/******************************************************************
+ * AUTOPILOT : EVADE
+ * Point away from where the rock will be closest and thrust once
+ * roughly pointed that way
+ ****************************************************************/
+int Autopilot::evade(const Ship & ship, const Rocks & rock)
+{
+   float dx = ship.getPosition().getX() - rock.getPosition().getX();
+   float dy = ship.getPosition().getY() - rock.getPosition().getY();
+   float heading = ship.getRotation() + 90;
+   float away    = headingOf(dx, dy);
+
+   int keys = steer(heading, away);
+   float diff = fmod(away - heading + 540.0, 360.0) - 180.0;
+   if (fabs(diff) < AUTOPILOT_THRUST_ANGLE)
+      keys |= INPUT_UP;
+   return keys;
+}
+
+/******************************************************************
+ * AUTOPILOT : ATTACK
+ * Lead the target: a bullet leaves at the ship's heading and
+ * speed plus its own, so find the time t where the rock and a
+ * bullet fired now are in the same place,
+ *    |d + v t| = s t
+ * turn toward that spot, and fire once lined up and in range
+ ****************************************************************/
+int Autopilot::attack(const Ship & ship, const Rocks & rock)
+{
+   float vx = ship.getVelocity().getDx();
+   float vy = ship.getVelocity().getDy();
+   float s  = (float)(AUTOPILOT_BULLET_SPEED + sqrt(vx * vx + vy * vy));
+
+   float rdx, rdy;
+   rockVelocity(rock, rdx, rdy);
+   float dx = rock.getPosition().getX() - ship.getPosition().getX();
+   float dy = rock.getPosition().getY() - ship.getPosition().getY();
+
+   float a = rdx * rdx + rdy * rdy - s * s;
+   float b = 2 * (dx * rdx + dy * rdy);
+   float c = dx * dx + dy * dy;
+   float t = 0.0;
+   float disc = b * b - 4 * a * c;
+   if (a != 0.0 && disc >= 0.0)
+   {
+      float t1 = (float)((-b - sqrt(disc)) / (2 * a));
+      float t2 = (float)((-b + sqrt(disc)) / (2 * a));
+      t = (t1 > 0.0 && (t1 < t2 || t2 <= 0.0)) ? t1 : t2;
+      if (t < 0.0)
+         t = 0.0;
+   }
+
+   float heading = ship.getRotation() + 90;
+   float desired = headingOf(dx + rdx * t, dy + rdy * t);
+   int keys = steer(heading, desired);
+
+   // harder means a tighter aim, more aggressive means more bullets
+   float tolerance = 3.0 + (AUTOPILOT_KNOB_MAX - difficulty) * 2.0;
+   float diff = fmod(desired - heading + 540.0, 360.0) - 180.0;
+   bool inRange = t <= AUTOPILOT_BULLET_LIFE;
+   if (fabs(diff) <= tolerance && inRange && coolDown == 0)
+   {
+      keys |= INPUT_SPACE;
+      coolDown = 1 + AUTOPILOT_KNOB_MAX - aggression;
+   }
+
+   // the eager ones go looking for trouble
+   if (!inRange && aggression > AUTOPILOT_KNOB_MAX / 2 &&
+       fabs(diff) < AUTOPILOT_THRUST_ANGLE / 2)
+      keys |= INPUT_UP;
+   return keys;
+}
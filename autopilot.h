@@ -0,0 +1,67 @@
+/***********************************************************************
+ * Header File:
+ *    Autopilot : a player that never gets tired
+ * Summary:
+ *    For long soak runs and load tests nobody wants to sit at the
+ *    keyboard.  The autopilot looks at the ship and the rocks each tick
+ *    and presses the same keys a player would: it turns away from and
+ *    flies clear of any rock about to hit it, otherwise turns toward
+ *    where the nearest rock will be when a bullet gets there and fires,
+ *    and presses down to come back after dying.
+ *
+ *    It uses no random numbers and keeps no state but its own
+ *    counters, so the same game and the same settings always produce
+ *    the same keys.
+ *
+ *    Two knobs, each 0 to 10:
+ *       difficulty     how tightly it aims and how soon it respawns
+ *       aggression     how often it fires and whether it chases rocks
+ ************************************************************************/
+
+#ifndef AUTOPILOT_H
+#define AUTOPILOT_H
+
+#define AUTOPILOT_KNOB_MAX      10
+#define AUTOPILOT_DEFAULT_KNOB  5
+
+class Game;
+class Rocks;
+class Ship;
+
+/*********************************************
+ * AUTOPILOT
+ *********************************************/
+class Autopilot
+{
+public:
+   Autopilot(int difficulty = AUTOPILOT_DEFAULT_KNOB,
+             int aggression = AUTOPILOT_DEFAULT_KNOB);
+
+   // the keys to hold this tick, as INPUT_* bits, for whichever
+   // player it is flying
+   int decide(const Game & game, int player = 0);
+
+   int getDifficulty() const { return difficulty; }
+   int getAggression() const { return aggression; }
+
+   // the counters, so a saved game can put them back
+   int getDeadTicks() const { return deadTicks; }
+   int getCoolDown()  const { return coolDown;  }
+   void restore(int deadTicks, int coolDown)
+   {
+      this->deadTicks = deadTicks;
+      this->coolDown  = coolDown;
+   }
+
+private:
+   int steer(float heading, float desired) const;
+   int evade(const Ship & ship, const Rocks & rock);
+   int attack(const Ship & ship, const Rocks & rock);
+
+   int difficulty;   // 0 .. AUTOPILOT_KNOB_MAX
+   int aggression;   // 0 .. AUTOPILOT_KNOB_MAX
+   int deadTicks;    // how long the ship has been gone
+   int coolDown;     // ticks until it may fire again
+};
+
+#endif // AUTOPILOT_H
@@ -0,0 +1,626 @@
+/***********************************************************************
+ * Source File:
+ *    Benchmark : play canned sessions as fast as possible
+ * Summary:
+ *    Every scenario seeds both the simulation and rand() so the rocks,
+ *    the stars and every random turn after that come out the same each
+ *    time.  The quality is held at its best so every run does the same
+ *    amount of work for the eye candy and the times compare.
+ ************************************************************************/
+
+#include <cstdio>     // for snprintf()
+#include <cstdlib>    // for srand() and strtoull()
+#include <fstream>
+#include <sstream>
+#include "benchmark.h"
+#include "game.h"
+#include "allocTracker.h"
+#include "qualityGovernor.h"
+#include "perfCounters.h"
+#include "frameTimer.h"
+#include "simRandom.h"
+#include "gameState.h"
+#include "rollback.h"   // for ROLLBACK_MAX_TICKS
+#include "server.h"
+#include "netClient.h"
+#include "broadcast.h"
+#include "replay.h"
+
+using namespace std;
+
+#define BENCH_DEFAULT_SEED   1
+#define BENCH_DEFAULT_TICKS  1000
+#define BENCH_BROADCAST      "asteroids-bench"   // in /dev/shm while running
+#define BENCH_REPLAY         "asteroids-bench.rpl"   // while running
+
+/******************************************************************
+ * SCENARIO : CONSTRUCTOR
+ ****************************************************************/
+Scenario::Scenario() : name("unnamed"),
+                       seed(BENCH_DEFAULT_SEED),
+                       rocks(INITIAL_ROCK_COUNT),
+                       ticks(BENCH_DEFAULT_TICKS),
+                       world(WORLD_DEFAULT_SIZE),
+                       hasHash(false),
+                       hash(0),
+                       autopilot(-1),
+                       aggression(AUTOPILOT_DEFAULT_KNOB),
+                       bots(0),
+                       botDifficulty(AUTOPILOT_DEFAULT_KNOB),
+                       botAggression(AUTOPILOT_DEFAULT_KNOB),
+                       rollback(0),
+                       clients(0),
+                       loss(0),
+                       spectators(0),
+                       seeks(0)
+{
+}
+
+/******************************************************************
+ * PARSE KEYS
+ * The rest of an "at" line: key names, or none
+ *   OUTPUT keys      INPUT_* bits
+ *          <return>  false on a name we do not know
+ ****************************************************************/
+static bool parseKeys(istringstream & in, int & keys)
+{
+   static const struct { const char * name; int bit; } names[] =
+   {
+      { "left",  INPUT_LEFT  }, { "right", INPUT_RIGHT },
+      { "up",    INPUT_UP    }, { "down",  INPUT_DOWN  },
+      { "space", INPUT_SPACE }, { "r",     INPUT_R     },
+      { "none",  0           }
+   };
+
+   keys = 0;
+   string word;
+   while (in >> word)
+   {
+      bool found = false;
+      for (size_t i = 0; i < sizeof(names) / sizeof(names[0]); i++)
+         if (word == names[i].name)
+         {
+            keys |= names[i].bit;
+            found = true;
+         }
+      if (!found)
+         return false;
+   }
+   return true;
+}
+
+/******************************************************************
+ * BENCHMARK : LOAD
+ *   INPUT  path      the scenario file
+ *   OUTPUT scenario  what it says
+ *          error     why not, if it could not be read
+ *          <return>  false if it could not be read
+ ****************************************************************/
+bool Benchmark::load(const char * path, Scenario & scenario, string & error)
+{
+   ifstream file(path);
+   if (!file.is_open())
+   {
+      error = "unable to open";
+      return false;
+   }
+
+   scenario = Scenario();
+   string line;
+   for (int number = 1; getline(file, line); number++)
+   {
+      size_t comment = line.find('#');
+      if (comment != string::npos)
+         line.erase(comment);
+
+      istringstream in(line);
+      string key;
+      if (!(in >> key))
+         continue;
+
+      bool ok = true;
+      if (key == "name")
+         ok = (bool)(in >> scenario.name);
+      else if (key == "seed")
+         ok = (bool)(in >> scenario.seed);
+      else if (key == "rocks")
+         ok = (in >> scenario.rocks) && scenario.rocks >= 0;
+      else if (key == "ticks")
+         ok = (in >> scenario.ticks) && scenario.ticks > 0;
+      else if (key == "world")
+         ok = (in >> scenario.world) && scenario.world > 0.0;
+      else if (key == "hash")
+      {
+         string hex;
+         ok = (bool)(in >> hex);
+         scenario.hash = strtoull(hex.c_str(), NULL, 16);
+         scenario.hasHash = ok;
+      }
+      else if (key == "autopilot")
+         ok = (in >> scenario.autopilot >> scenario.aggression) &&
+              scenario.autopilot >= 0 && scenario.autopilot <= AUTOPILOT_KNOB_MAX &&
+              scenario.aggression >= 0 && scenario.aggression <= AUTOPILOT_KNOB_MAX;
+      else if (key == "bots")
+         ok = (in >> scenario.bots >> scenario.botDifficulty >> scenario.botAggression) &&
+              scenario.bots >= 0 &&
+              scenario.botDifficulty >= 0 && scenario.botDifficulty <= AUTOPILOT_KNOB_MAX &&
+              scenario.botAggression >= 0 && scenario.botAggression <= AUTOPILOT_KNOB_MAX;
+      else if (key == "rollback")
+         ok = (in >> scenario.rollback) &&
+              scenario.rollback > 0 && scenario.rollback <= ROLLBACK_MAX_TICKS;
+      else if (key == "clients")
+         ok = (in >> scenario.clients >> scenario.loss) &&
+              scenario.clients > 0 && scenario.clients <= SERVER_MAX_CLIENTS &&
+              scenario.loss >= 0 && scenario.loss < 100;
+      else if (key == "spectators")
+         ok = (in >> scenario.spectators) && scenario.spectators > 0;
+      else if (key == "record")
+         ok = (in >> scenario.seeks) && scenario.seeks > 0;
+      else if (key == "at")
+      {
+         ScriptStep step;
+         ok = (in >> step.tick) && parseKeys(in, step.keys) &&
+              (scenario.script.empty() ||
+               scenario.script.back().tick <= step.tick);
+         scenario.script.push_back(step);
+      }
+      else
+         ok = false;
+
+      if (!ok)
+      {
+         error = "bad line " + to_string(number) + ": " + line;
+         return false;
+      }
+   }
+   return true;
+}
+
+/******************************************************************
+ * ROLLBACK TIMES
+ * What going back costs, added up over a run
+ ****************************************************************/
+struct RollbackTimes
+{
+   RollbackTimes() : save(0), restore(0), resim(0), resimTicks(0),
+                     restores(0), bytes(0) {}
+   long long save;         // ns in saveState()
+   long long restore;      // ns in loadState()
+   long long resim;        // ns playing ticks again
+   long long resimTicks;
+   long long restores;
+   size_t    bytes;        // biggest state saved
+};
+
+/******************************************************************
+ * REPLAY
+ * Go back to just before the tick depth ticks ago and play up to
+ * now again with the same keys, the way rollback does when a guess
+ * was wrong.  The game must end up exactly where it was
+ ****************************************************************/
+static void replay(Game & game, int tick, int depth,
+                   const vector<GameState> & states, const vector<int> & keys,
+                   RollbackTimes & times)
+{
+   int ring = (int)states.size();
+   int from = tick - depth + 1;
+
+   long long begin = monotonicNow();
+   game.loadState(states[from % ring]);
+   long long loaded = monotonicNow();
+
+   game.setResimulating(true);
+   for (int t = from; t <= tick; t++)
+   {
+      game.handleInput(keys[t % ring]);
+      game.advance();
+   }
+   game.setResimulating(false);
+
+   times.restore    += loaded - begin;
+   times.resim      += monotonicNow() - loaded;
+   times.resimTicks += depth;
+   times.restores++;
+}
+
+/******************************************************************
+ * START CLIENTS
+ * A server on the loopback and clients for it, each watching a
+ * bot so they are all looking at different parts of the world.
+ * None of them flies, so the game plays out as it would without
+ ****************************************************************/
+static bool startClients(const Scenario & scenario, vector<NetClient *> & clients)
+{
+   if (!Server::start(0))
+      return false;
+   string address = "127.0.0.1:" + to_string(Server::getPort());
+   for (int i = 0; i < scenario.clients; i++)
+   {
+      NetClient * pClient = new NetClient;
+      clients.push_back(pClient);
+      if (!pClient->connect(address.c_str(),
+                            scenario.bots > 0 ? 1 + i % scenario.bots : 0))
+         return false;
+      pClient->setLoss(scenario.loss);
+   }
+   return true;
+}
+
+/******************************************************************
+ * WRITE CLIENTS
+ * What serving them cost, per client per tick.  full_bytes is the
+ * whole last tick with no baseline, for how much the deltas and
+ * sending each client only what is near it save; view_entities is
+ * how much of the world a client was sent
+ ****************************************************************/
+static void writeClients(const Game & game, const vector<NetClient *> & clients,
+                         long long clientNs, ostream & out)
+{
+   long long sent = Server::getSnapshotsSent();
+   long long received = 0;
+   long long lost = 0;
+   long long decodeNs = 0;
+   for (size_t i = 0; i < clients.size(); i++)
+   {
+      received += clients[i]->getSnapshots();
+      lost     += clients[i]->getLost();
+      decodeNs += clients[i]->getDecodeNs();
+   }
+
+   Snapshot snapshot;
+   game.captureSnapshot(snapshot, 0);
+   static unsigned char buffer[SERVER_PACKET_MAX];
+   BitWriter full(buffer, sizeof(buffer));
+   snapshot.encode(NULL, full);
+
+   double bytes = sent > 0 ? (double)Server::getBytesSent() / sent : 0.0;
+   out << ",\"clients\":" << clients.size()
+       << ",\"loss\":" << (sent > 0 ? 100.0 * lost / sent : 0.0)
+       << ",\"bytes_per_client_tick\":" << bytes
+       << ",\"kbit_per_client_at_30hz\":" << bytes * 8 * 30 / 1000
+       << ",\"full_bytes\":" << full.finish()
+       << ",\"full_snapshots\":" << Server::getFullSent()
+       << ",\"view_entities\":"
+       << (sent > 0 ? (double)Server::getEntitiesSent() / sent : 0.0)
+       << ",\"world_entities\":"
+       << (sent > 0 ? (double)Server::getEntitiesSeen() / sent : 0.0)
+       << ",\"server_us_per_client\":"
+       << (sent > 0 ? (Server::getCaptureNs() + Server::getClientNs()) / 1000.0 / sent : 0.0)
+       << ",\"client_us\":"
+       << (received > 0 ? decodeNs / 1000.0 / received : 0.0)
+       << ",\"poll_us\":"
+       << (sent > 0 ? clientNs / 1000.0 / sent : 0.0);
+}
+
+/******************************************************************
+ * START SPECTATORS
+ * A broadcast in shared memory, and viewers for it
+ ****************************************************************/
+static bool startSpectators(const Scenario & scenario,
+                            vector<BroadcastView *> & spectators)
+{
+   if (!Broadcast::open(BENCH_BROADCAST))
+      return false;
+   Broadcast::setWorld(scenario.world, scenario.world);
+   for (int i = 0; i < scenario.spectators; i++)
+   {
+      BroadcastView * pView = new BroadcastView;
+      spectators.push_back(pView);
+      if (!pView->attach(BENCH_BROADCAST))
+         return false;
+   }
+   return true;
+}
+
+/******************************************************************
+ * WRITE SPECTATORS
+ * What publishing a frame cost the game, and reading one a viewer
+ ****************************************************************/
+static void writeSpectators(const vector<BroadcastView *> & spectators,
+                            long long broadcastNs, long long spectatorNs,
+                            int ticks, ostream & out)
+{
+   long long torn = 0;
+   for (size_t i = 0; i < spectators.size(); i++)
+      torn += spectators[i]->getTorn();
+   long long reads = (long long)ticks * spectators.size();
+   out << ",\"spectators\":" << spectators.size()
+       << ",\"broadcast_us\":" << broadcastNs / 1000.0 / ticks
+       << ",\"spectator_us\":" << (reads > 0 ? spectatorNs / 1000.0 / reads : 0.0)
+       << ",\"torn\":" << torn;
+}
+
+/******************************************************************
+ * STOP SPECTATORS
+ ****************************************************************/
+static void stopSpectators(vector<BroadcastView *> & spectators)
+{
+   for (size_t i = 0; i < spectators.size(); i++)
+      delete spectators[i];
+   spectators.clear();
+   Broadcast::close();
+}
+
+/******************************************************************
+ * CHECK REPLAY
+ * Open what was recorded, jump about in it, then play it to the end,
+ * where it must be just where the game was.  The file is removed
+ * again either way
+ ****************************************************************/
+static bool checkReplay(const Scenario & scenario, unsigned long long hash,
+                        ostream & out)
+{
+   ReplayReader reader;
+   if (!reader.open(BENCH_REPLAY))
+   {
+      remove(BENCH_REPLAY);
+      return false;
+   }
+   const ReplayHeader & header = reader.getHeader();
+   Game * pGame = reader.createGame();
+   long long total = 0;
+   long long worst = 0;
+   bool ok = true;
+   for (int i = 0; i < scenario.seeks && ok; i++)
+   {
+      // scattered, but the same every run
+      int tick = (int)((i * 2654435761ULL) % (header.ticks + 1));
+      long long start = monotonicNow();
+      ok = reader.seek(*pGame, tick);
+      long long took = monotonicNow() - start;
+      total += took;
+      if (took > worst)
+         worst = took;
+   }
+   ok = ok && reader.seek(*pGame, header.ticks) &&
+        pGame->getStateHash() == hash && header.hash == hash;
+
+   out << ",\"replay_bytes\":" << reader.getBytes()
+       << ",\"keyframes\":" << header.keyframes
+       << ",\"mean_seek_ms\":" << total / 1000000.0 / scenario.seeks
+       << ",\"worst_seek_ms\":" << worst / 1000000.0
+       << ",\"replay_match\":" << (ok ? "true" : "false");
+   delete pGame;
+   reader.close();
+   remove(BENCH_REPLAY);
+   return ok;
+}
+
+/******************************************************************
+ * STOP CLIENTS
+ ****************************************************************/
+static void stopClients(vector<NetClient *> & clients)
+{
+   for (size_t i = 0; i < clients.size(); i++)
+      delete clients[i];
+   clients.clear();
+   Server::stop();
+}
+
+/******************************************************************
+ * BENCHMARK : RUN
+ * Advance the game as fast as it will go, holding whatever keys
+ * the script says.  With rollback, every tick is followed by going
+ * back and playing the last few again, which is not counted in the
+ * tick times
+ *   INPUT  scenario  what to play
+ *   OUTPUT out       one line of JSON
+ *          <return>  false if the hash came out wrong
+ ****************************************************************/
+bool Benchmark::run(const Scenario & scenario, ostream & out)
+{
+   srand(scenario.seed);
+   SimRandom::seed(scenario.seed);
+   QualityGovernor::pin(QUALITY_BEST);
+   PerfCounters::reset();
+   long long allocations = AllocTracker::getTotal().allocations;
+
+   Point topLeft(-scenario.world, scenario.world);
+   Point bottomRight(scenario.world, -scenario.world);
+   Game game(topLeft, bottomRight, scenario.rocks);
+   game.addBots(scenario.bots, scenario.botDifficulty, scenario.botAggression);
+   Autopilot autopilot(scenario.autopilot, scenario.aggression);
+
+   // with rollback: the state before and the keys for each recent tick
+   RollbackTimes times;
+   vector<GameState> states(scenario.rollback > 0 ? scenario.rollback + 1 : 0);
+   vector<int> history(states.size());
+
+   // with clients: a server on the loopback and its audience
+   vector<NetClient *> clients;
+   long long clientNs = 0;
+   if (scenario.clients > 0 && !startClients(scenario, clients))
+   {
+      cerr << scenario.name << ": unable to serve on the loopback" << endl;
+      stopClients(clients);
+      return false;
+   }
+
+   // with spectators: a broadcast and its viewers
+   vector<BroadcastView *> spectators;
+   vector<BroadcastEntity> seen;
+   long long broadcastNs = 0;
+   long long spectatorNs = 0;
+   if (scenario.spectators > 0 && !startSpectators(scenario, spectators))
+   {
+      cerr << scenario.name << ": unable to broadcast" << endl;
+      stopSpectators(spectators);
+      stopClients(clients);
+      return false;
+   }
+
+   // with a recording: everything it takes to play the run again
+   if (scenario.seeks > 0 &&
+       !ReplayRecorder::start(BENCH_REPLAY, scenario.seed, scenario.world,
+                              scenario.rocks, 1, scenario.bots,
+                              scenario.botDifficulty, scenario.botAggression))
+   {
+      cerr << scenario.name << ": unable to record to " << BENCH_REPLAY << endl;
+      stopSpectators(spectators);
+      stopClients(clients);
+      return false;
+   }
+
+   size_t step = 0;
+   int keys = 0;
+   long long worst = 0;
+   long long start = monotonicNow();
+   for (int tick = 0; tick < scenario.ticks; tick++)
+   {
+      while (step < scenario.script.size() && scenario.script[step].tick <= tick)
+         keys = scenario.script[step++].keys;
+      if (scenario.autopilot >= 0)
+         keys = autopilot.decide(game);
+
+      if (ReplayRecorder::isActive())
+      {
+         long long recordStart = monotonicNow();
+         ReplayRecorder::record(game, &keys);
+         start += monotonicNow() - recordStart;
+      }
+
+      if (scenario.rollback > 0)
+      {
+         long long saveStart = monotonicNow();
+         GameState & state = states[tick % states.size()];
+         game.saveState(state);
+         history[tick % states.size()] = keys;
+         long long saveTime = monotonicNow() - saveStart;
+         times.save += saveTime;
+         start += saveTime;
+         if (state.getBytes() > times.bytes)
+            times.bytes = state.getBytes();
+      }
+
+      long long tickStart = monotonicNow();
+      AllocTracker::beginFrame();
+      PerfCounters::beginFrame();
+      game.handleInput(keys);
+      game.advance();
+      EventBus::endFrame();
+      AllocTracker::endFrame();
+      long long tickTime = monotonicNow() - tickStart;
+      if (tickTime > worst)
+         worst = tickTime;
+
+      if (scenario.rollback > 0 && tick >= scenario.rollback - 1)
+      {
+         long long replayStart = monotonicNow();
+         replay(game, tick, scenario.rollback, states, history, times);
+         start += monotonicNow() - replayStart;
+      }
+
+      if (!spectators.empty())
+      {
+         long long broadcastStart = monotonicNow();
+         game.broadcast();
+         long long broadcast = monotonicNow();
+         for (size_t i = 0; i < spectators.size(); i++)
+            spectators[i]->read(seen);
+         spectatorNs += monotonicNow() - broadcast;
+         broadcastNs += broadcast - broadcastStart;
+         start += monotonicNow() - broadcastStart;
+      }
+
+      if (!clients.empty())
+      {
+         long long serveStart = monotonicNow();
+         Server::receive(game);
+         Server::send(game);
+         long long served = monotonicNow();
+         for (size_t i = 0; i < clients.size(); i++)
+            clients[i]->poll();
+         clientNs += monotonicNow() - served;
+         start += monotonicNow() - serveStart;
+      }
+   }
+   long long elapsed = monotonicNow() - start;
+   allocations = AllocTracker::getTotal().allocations - allocations;
+   ReplayRecorder::stop();
+
+   unsigned long long hash = game.getStateHash();
+   bool match = !scenario.hasHash || hash == scenario.hash;
+
+   char hex[32];
+   snprintf(hex, sizeof(hex), "\"%016llx\"", hash);
+   out << "{\"scenario\":\"" << scenario.name << '"'
+       << ",\"seed\":" << scenario.seed
+       << ",\"rocks\":" << scenario.rocks
+       << ",\"ticks\":" << scenario.ticks
+       << ",\"bots\":" << scenario.bots
+       << ",\"ticks_per_sec\":"
+       << (elapsed > 0 ? scenario.ticks * 1000000000.0 / elapsed : 0.0)
+       << ",\"mean_tick_us\":" << elapsed / 1000.0 / scenario.ticks
+       << ",\"worst_tick_us\":" << worst / 1000.0
+       << ",\"allocations\":";
+   if (AllocTracker::isEnabled())
+      out << allocations;
+   else
+      out << "null";
+   out << ",\"score\":" << game.getScore()
+       << ",\"hash\":" << hex
+       << ",\"expected\":";
+   if (scenario.hasHash)
+   {
+      snprintf(hex, sizeof(hex), "\"%016llx\"", scenario.hash);
+      out << hex;
+   }
+   else
+      out << "null";
+   out << ",\"match\":" << (match ? "true" : "false");
+   if (scenario.rollback > 0)
+   {
+      long long ticks = scenario.ticks;
+      out << ",\"rollback\":" << scenario.rollback
+          << ",\"resim_ticks_per_ms\":"
+          << (times.resim > 0 ? times.resimTicks * 1000000.0 / times.resim : 0.0)
+          << ",\"save_us\":" << times.save / 1000.0 / ticks
+          << ",\"restore_us\":"
+          << (times.restores > 0 ? times.restore / 1000.0 / times.restores : 0.0)
+          << ",\"state_bytes\":" << times.bytes;
+   }
+   if (!clients.empty())
+      writeClients(game, clients, clientNs, out);
+   stopClients(clients);
+   if (scenario.spectators > 0)
+      writeSpectators(spectators, broadcastNs, spectatorNs, scenario.ticks, out);
+   stopSpectators(spectators);
+   if (scenario.seeks > 0 && !checkReplay(scenario, hash, out))
+      match = false;
+   if (PerfCounters::isAvailable())
+   {
+      out << ",\"perf\":";
+      PerfCounters::writeJson(out);
+   }
+   out << '}' << endl;
+   return match;
+}
+
+/******************************************************************
+ * BENCHMARK : RUN ALL
+ *   INPUT  count, paths   the scenario files
+ *   OUTPUT out            a line of JSON for each
+ *          <return>       0 if all ran and matched, 1 if a hash did
+ *                         not match, 2 if a file was bad
+ ****************************************************************/
+int Benchmark::runAll(int count, char ** paths, ostream & out)
+{
+   int result = 0;
+   for (int i = 0; i < count; i++)
+   {
+      Scenario scenario;
+      string error;
+      if (!load(paths[i], scenario, error))
+      {
+         cerr << paths[i] << ": " << error << endl;
+         return 2;
+      }
+      if (!run(scenario, out))
+      {
+         cerr << paths[i] << ": state hash does not match, "
+              << "the game played differently" << endl;
+         result = 1;
+      }
+   }
+   return result;
+}
@@ -0,0 +1,108 @@
+/***********************************************************************
+ * Header File:
+ *    Benchmark : play canned sessions as fast as possible
+ * Summary:
+ *    A scenario is a seed, how many big rocks to start with, how many
+ *    ticks to run and a script of which keys are held when.  Running
+ *    one needs no window: the game is advanced tick after tick with no
+ *    drawing and no pacing, and we report how fast it went, the worst
+ *    tick, how much it allocated and a hash of where everything ended
+ *    up.
+ *
+ *    If the scenario says what the hash should be, a run that comes
+ *    out different fails.  A change meant only to make things faster
+ *    should never change how the game plays.
+ *
+ *    Scenario files are plain text, one setting per line:
+ *       name     cascade
+ *       seed     7
+ *       rocks    40
+ *       ticks    3000
+ *       world    400           (optional, half the arena's width)
+ *       hash     0123abcd...   (optional, what the end should hash to)
+ *       at 0     up left       keys held from tick 0 on
+ *       at 90    space         ... replaced from tick 90 on
+ *       at 120   none
+ *       autopilot 5 8          let the bot fly instead, at this difficulty
+ *                              and aggression
+ *       bots     20 5 8        twenty more ships flown by bots, at this
+ *                              difficulty and aggression
+ *       rollback 8             after every tick, go back 8 ticks and play
+ *                              them again, timing it.  The hash must not
+ *                              change
+ *       clients  16 5          serve snapshots over the loopback to 16
+ *                              clients watching the bots, each throwing
+ *                              away 5 percent of them
+ *       spectators 4           broadcast every tick through shared memory
+ *                              to 4 viewers in this process
+ *       record   100           save a replay of the session, then seek
+ *                              to 100 ticks spread across it, timing it.
+ *                              Played to the end it must hash the same
+ *    Keys are left, right, up, down, space and r.  # starts a comment.
+ ************************************************************************/
+
+#ifndef BENCHMARK_H
+#define BENCHMARK_H
+
+#include <iostream>
+#include <string>
+#include <vector>
+
+/*********************************************
+ * SCRIPT STEP
+ * From this tick on, hold these keys
+ *********************************************/
+struct ScriptStep
+{
+   int tick;
+   int keys;   // INPUT_* bits
+};
+
+/*********************************************
+ * SCENARIO
+ * One canned session
+ *********************************************/
+struct Scenario
+{
+   Scenario();
+
+   std::string             name;
+   unsigned int            seed;
+   int                     rocks;
+   int                     ticks;
+   float                   world;
+   bool                    hasHash;   // do we know what it should be?
+   unsigned long long      hash;
+   std::vector<ScriptStep> script;    // in tick order
+   int                     autopilot; // difficulty, or -1 to use the script
+   int                     aggression;
+   int                     bots;      // ships besides the player's
+   int                     botDifficulty;
+   int                     botAggression;
+   int                     rollback;  // ticks to replay each tick, or 0
+   int                     clients;   // served over the loopback, or 0
+   int                     loss;      // percent of snapshots they drop
+   int                     spectators;   // reading the broadcast, or 0
+   int                     seeks;     // into a replay of the run, or 0
+};
+
+/*********************************************
+ * BENCHMARK
+ *********************************************/
+class Benchmark
+{
+public:
+   // read a scenario file.  Returns false, with a reason, if it is
+   // not one
+   static bool load(const char * path, Scenario & scenario,
+                    std::string & error);
+
+   // play it and write one line of JSON about how it went.  Returns
+   // false if the final hash is not the one expected
+   static bool run(const Scenario & scenario, std::ostream & out);
+
+   // load and run every file.  Returns the exit code for main()
+   static int runAll(int count, char ** paths, std::ostream & out);
+};
+
+#endif // BENCHMARK_H
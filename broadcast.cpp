@@ -0,0 +1,308 @@
+/***********************************************************************
+ * Source File:
+ *    Broadcast : every frame, for anyone on this machine to watch
+ * Summary:
+ *    On Linux the ring is a file in /dev/shm, which is memory; on
+ *    Windows it is a named mapping backed by the paging file.  Either
+ *    way the game maps it once at the start, touches every page so no
+ *    frame ever faults one in, and from then on only writes memory.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for memset()
+#include <string>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>        // for open()
+#include <unistd.h>       // for close(), ftruncate() and unlink()
+#include <sys/mman.h>     // for mmap()
+#include <sys/stat.h>     // for fstat()
+#endif // _WIN32
+
+#include "broadcast.h"
+
+using namespace std;
+
+#define BROADCAST_BYTES  (sizeof(BroadcastHeader) + \
+                          BROADCAST_SLOTS * sizeof(BroadcastSlot))
+
+BroadcastHeader * Broadcast::pHeader   = NULL;
+BroadcastSlot *   Broadcast::pSlot     = NULL;
+long long         Broadcast::published = 0;
+
+static string path;                // what we made, to remove it again
+#ifdef _WIN32
+static HANDLE mapping = NULL;
+#endif // _WIN32
+
+/******************************************************************
+ * PATH OF
+ * Where a broadcast of this name lives
+ ****************************************************************/
+static string pathOf(const char * name)
+{
+#ifdef _WIN32
+   return string("Local\\asteroids-") + name;
+#else
+   return string("/dev/shm/") + name;
+#endif // _WIN32
+}
+
+/******************************************************************
+ * SLOTS OF
+ * They come right after the header
+ ****************************************************************/
+static inline BroadcastSlot * slotsOf(BroadcastHeader * pHeader)
+{
+   return (BroadcastSlot *)(pHeader + 1);
+}
+
+static inline const BroadcastSlot * slotsOf(const BroadcastHeader * pHeader)
+{
+   return (const BroadcastSlot *)(pHeader + 1);
+}
+
+/******************************************************************
+ * BROADCAST : OPEN
+ * The magic goes in last, so a viewer that attaches while we are
+ * still setting up sees a file that is not ready
+ ****************************************************************/
+bool Broadcast::open(const char * name)
+{
+   assert(!isOpen());
+   path = pathOf(name);
+   void * memory = NULL;
+
+#ifdef _WIN32
+   mapping = CreateFileMappingA(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE,
+                                0, (DWORD)BROADCAST_BYTES, path.c_str());
+   if (mapping == NULL)
+      return false;
+   memory = MapViewOfFile(mapping, FILE_MAP_WRITE, 0, 0, BROADCAST_BYTES);
+   if (memory == NULL)
+   {
+      CloseHandle(mapping);
+      mapping = NULL;
+      return false;
+   }
+#else
+   int fd = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+   if (fd < 0)
+      return false;
+   if (ftruncate(fd, BROADCAST_BYTES) != 0)
+   {
+      ::close(fd);
+      unlink(path.c_str());
+      return false;
+   }
+   memory = mmap(NULL, BROADCAST_BYTES, PROT_READ | PROT_WRITE, MAP_SHARED,
+                 fd, 0);
+   ::close(fd);
+   if (memory == MAP_FAILED)
+   {
+      unlink(path.c_str());
+      return false;
+   }
+#endif // _WIN32
+
+   // every page now, rather than one at a time in the middle of frames
+   memset(memory, 0, BROADCAST_BYTES);
+
+   pHeader = (BroadcastHeader *)memory;
+   pHeader->version  = BROADCAST_VERSION;
+   pHeader->slots    = BROADCAST_SLOTS;
+   pHeader->capacity = BROADCAST_ENTITIES;
+   pHeader->worldX   = 0.0;
+   pHeader->worldY   = 0.0;
+   pHeader->published.store(0, memory_order_relaxed);
+   pHeader->live.store(1, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+   pHeader->magic    = BROADCAST_MAGIC;
+   published = 0;
+   return true;
+}
+
+/******************************************************************
+ * BROADCAST : SET WORLD
+ ****************************************************************/
+void Broadcast::setWorld(float halfWidth, float halfHeight)
+{
+   assert(isOpen());
+   pHeader->worldX = halfWidth;
+   pHeader->worldY = halfHeight;
+}
+
+/******************************************************************
+ * BROADCAST : CLOSE
+ ****************************************************************/
+void Broadcast::close()
+{
+   if (!isOpen())
+      return;
+   pHeader->live.store(0, memory_order_release);
+#ifdef _WIN32
+   UnmapViewOfFile(pHeader);
+   CloseHandle(mapping);
+   mapping = NULL;
+#else
+   munmap(pHeader, BROADCAST_BYTES);
+   unlink(path.c_str());
+#endif // _WIN32
+   pHeader = NULL;
+   pSlot   = NULL;
+}
+
+/******************************************************************
+ * BROADCAST : BEGIN FRAME
+ * Mark the oldest slot as being written before touching it
+ ****************************************************************/
+BroadcastEntity * Broadcast::beginFrame(unsigned int frame)
+{
+   assert(isOpen() && pSlot == NULL);
+   unsigned long long index = pHeader->published.load(memory_order_relaxed);
+   pSlot = &slotsOf(pHeader)[index % BROADCAST_SLOTS];
+   pSlot->sequence.store(2 * index + 1, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+   pSlot->frame = frame;
+   return pSlot->entities;
+}
+
+/******************************************************************
+ * BROADCAST : END FRAME
+ ****************************************************************/
+void Broadcast::endFrame(int count)
+{
+   assert(isOpen() && pSlot != NULL);
+   assert(count >= 0 && count <= BROADCAST_ENTITIES);
+   unsigned long long index = pHeader->published.load(memory_order_relaxed);
+   pSlot->count = count;
+   pSlot->sequence.store(2 * (index + 1), memory_order_release);
+   pHeader->published.store(index + 1, memory_order_release);
+   pSlot = NULL;
+   published++;
+}
+
+/******************************************************************
+ * BROADCAST VIEW : ATTACH
+ ****************************************************************/
+bool BroadcastView::attach(const char * name)
+{
+   assert(!isAttached());
+   string where = pathOf(name);
+   const void * memory = NULL;
+
+#ifdef _WIN32
+   HANDLE viewed = OpenFileMappingA(FILE_MAP_READ, FALSE, where.c_str());
+   if (viewed == NULL)
+      return false;
+   memory = MapViewOfFile(viewed, FILE_MAP_READ, 0, 0, BROADCAST_BYTES);
+   CloseHandle(viewed);              // the view keeps it alive
+   if (memory == NULL)
+      return false;
+#else
+   int fd = ::open(where.c_str(), O_RDONLY);
+   if (fd < 0)
+      return false;
+   struct stat status;
+   if (fstat(fd, &status) != 0 || status.st_size < (off_t)BROADCAST_BYTES)
+   {
+      ::close(fd);
+      return false;
+   }
+   memory = mmap(NULL, BROADCAST_BYTES, PROT_READ, MAP_SHARED, fd, 0);
+   ::close(fd);
+   if (memory == MAP_FAILED)
+      return false;
+#endif // _WIN32
+
+   pHeader = (const BroadcastHeader *)memory;
+   size    = BROADCAST_BYTES;
+   atomic_thread_fence(memory_order_acquire);
+   if (pHeader->magic != BROADCAST_MAGIC ||
+       pHeader->version != BROADCAST_VERSION ||
+       pHeader->slots != BROADCAST_SLOTS ||
+       pHeader->capacity != BROADCAST_ENTITIES)
+   {
+      detach();
+      return false;
+   }
+   last    = -1;
+   torn    = 0;
+   skipped = 0;
+   return true;
+}
+
+/******************************************************************
+ * BROADCAST VIEW : DETACH
+ ****************************************************************/
+void BroadcastView::detach()
+{
+   if (!isAttached())
+      return;
+#ifdef _WIN32
+   UnmapViewOfFile(pHeader);
+#else
+   munmap((void *)pHeader, size);
+#endif // _WIN32
+   pHeader = NULL;
+   size    = 0;
+}
+
+/******************************************************************
+ * BROADCAST VIEW : IS LIVE
+ ****************************************************************/
+bool BroadcastView::isLive() const
+{
+   return pHeader && pHeader->live.load(memory_order_acquire) != 0;
+}
+
+float BroadcastView::getWorldX() const { return pHeader ? pHeader->worldX : 0.0; }
+float BroadcastView::getWorldY() const { return pHeader ? pHeader->worldY : 0.0; }
+
+/******************************************************************
+ * BROADCAST VIEW : READ
+ * Copy the newest frame between two looks at its sequence.  If the
+ * game lapped us meanwhile the copy is thrown away and the new
+ * newest tried.  It can only lap us so many times while we copy
+ ****************************************************************/
+long long BroadcastView::read(vector<BroadcastEntity> & entities)
+{
+   if (!isAttached())
+      return -1;
+   const BroadcastSlot * slots = slotsOf(pHeader);
+   for (int attempt = 0; attempt < BROADCAST_SLOTS; attempt++)
+   {
+      unsigned long long published =
+         pHeader->published.load(memory_order_acquire);
+      if (published == 0 || (long long)published - 1 <= last)
+         return -1;
+      unsigned long long index = published - 1;
+      const BroadcastSlot & slot = slots[index % BROADCAST_SLOTS];
+
+      unsigned long long before = slot.sequence.load(memory_order_acquire);
+      if (before != 2 * (index + 1))
+      {
+         torn++;
+         continue;
+      }
+      unsigned int frame = slot.frame;
+      unsigned int count = slot.count;
+      if (count > BROADCAST_ENTITIES)
+         count = BROADCAST_ENTITIES;
+      entities.assign(slot.entities, slot.entities + count);
+      atomic_thread_fence(memory_order_acquire);
+      if (slot.sequence.load(memory_order_relaxed) != before)
+      {
+         torn++;
+         continue;
+      }
+
+      if (last >= 0)
+         skipped += (long long)index - last - 1;
+      last = (long long)index;
+      return frame;
+   }
+   return -1;
+}
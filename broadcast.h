@@ -0,0 +1,171 @@
+/***********************************************************************
+ * Header File:
+ *    Broadcast : every frame, for anyone on this machine to watch
+ * Summary:
+ *    The game copies what it would draw each frame, ships, rocks,
+ *    bullets and debris, into a ring of frames in a shared memory file
+ *    (/dev/shm/<name> on Linux).  Dashboards and other viewers map the
+ *    file and read the newest frame whenever they like.  They map it
+ *    read only, so however many come and go, and however slowly they
+ *    read, the game never knows or waits.
+ *
+ *    The file is the layout below, nothing more: a header, then the
+ *    slots, each one frame.  A slot's sequence is odd while the game is
+ *    writing it and 2 * (n + 1) once it holds the n-th frame published.
+ *    A viewer reads the sequence, copies the frame, and reads the
+ *    sequence again; if the two differ the game came round and wrote
+ *    over it meanwhile, and the viewer tries the newest frame again.
+ *    Publishing a frame is just writing memory: no system calls, no
+ *    locks.
+ ************************************************************************/
+
+#ifndef BROADCAST_H
+#define BROADCAST_H
+
+#include <atomic>
+#include <cstddef>    // for NULL
+#include <vector>
+
+#define BROADCAST_MAGIC     0x41534252   // "ASBR"
+#define BROADCAST_VERSION   1
+#define BROADCAST_SLOTS     8            // frames in the ring
+#define BROADCAST_ENTITIES  4096         // in one frame; the rest are left off
+
+// what an entity is
+#define BROADCAST_SHIP    0   // detail: BROADCAST_ALIVE | BROADCAST_THRUSTING
+#define BROADCAST_ROCK    1   // detail: the tier
+#define BROADCAST_BULLET  2   // detail: the weapon
+#define BROADCAST_DEBRIS  3
+
+#define BROADCAST_ALIVE      0x01
+#define BROADCAST_THRUSTING  0x02
+
+/*********************************************
+ * BROADCAST ENTITY
+ * One thing on the screen.  16 bytes, no
+ * padding, the same on every compiler
+ *********************************************/
+struct BroadcastEntity
+{
+   float          x;          // world units
+   float          y;
+   unsigned short rotation;   // degrees
+   unsigned char  kind;       // BROADCAST_*
+   unsigned char  detail;     // depends on the kind
+   unsigned char  red;        // the colour the game draws it
+   unsigned char  green;
+   unsigned char  blue;
+   unsigned char  owner;      // the player, for ships and bullets
+};
+
+/*********************************************
+ * BROADCAST SLOT
+ * One frame
+ *********************************************/
+struct BroadcastSlot
+{
+   std::atomic<unsigned long long> sequence;   // odd while being written
+   unsigned int    frame;
+   unsigned int    count;                      // entities used
+   BroadcastEntity entities[BROADCAST_ENTITIES];
+};
+
+/*********************************************
+ * BROADCAST HEADER
+ * The start of the file.  The slots follow it
+ *********************************************/
+struct BroadcastHeader
+{
+   unsigned int magic;                       // BROADCAST_MAGIC
+   unsigned int version;                     // BROADCAST_VERSION
+   unsigned int slots;                       // BROADCAST_SLOTS
+   unsigned int capacity;                    // BROADCAST_ENTITIES
+   float        worldX;                      // half the arena's width
+   float        worldY;                      // and height
+   std::atomic<unsigned int>       live;     // 0 once the game has gone
+   unsigned int                    reserved;
+   std::atomic<unsigned long long> published;   // frames written so far
+   unsigned char pad[24];                    // to 64 bytes
+};
+
+static_assert(sizeof(BroadcastEntity) == 16, "the entity layout is fixed");
+static_assert(sizeof(BroadcastHeader) == 64, "the header layout is fixed");
+static_assert(std::atomic<unsigned long long>::is_always_lock_free,
+              "the sequences are shared between processes");
+
+/*********************************************
+ * BROADCAST
+ * The game's end.  There is one game, so
+ * everything is static.  Only the game thread
+ * publishes
+ *********************************************/
+class Broadcast
+{
+public:
+   // make the file and map it.  False if we cannot
+   static bool open(const char * name);
+
+   // tell the viewers we are gone and remove the file.  Viewers still
+   // attached keep what they had
+   static void close();
+
+   static bool isOpen() { return pHeader != NULL; }
+
+   // how big the arena is, for viewers to fit it on their screens
+   static void setWorld(float halfWidth, float halfHeight);
+
+   // the slot for this frame, to fill in with up to BROADCAST_ENTITIES,
+   // and then to let the viewers have
+   static BroadcastEntity * beginFrame(unsigned int frame);
+   static void endFrame(int count);
+
+   static long long getPublished() { return published; }
+
+private:
+   static BroadcastHeader * pHeader;
+   static BroadcastSlot *   pSlot;     // being written
+   static long long         published;
+};
+
+/*********************************************
+ * BROADCAST VIEW
+ * A viewer's end.  There may be any number, in
+ * any process, and this one may come and go
+ *********************************************/
+class BroadcastView
+{
+public:
+   BroadcastView() : pHeader(NULL), size(0), last(-1), torn(0),
+                     skipped(0) {}
+   ~BroadcastView() { detach(); }
+
+   // map the game's file.  False if there is none or it is not ours
+   bool attach(const char * name);
+   void detach();
+
+   bool isAttached() const { return pHeader != NULL; }
+
+   // is the game still publishing?
+   bool isLive() const;
+
+   float getWorldX() const;
+   float getWorldY() const;
+
+   // copy the newest frame, if it is newer than the last one we read.
+   // Returns its number, or -1 if there is nothing new
+   long long read(std::vector<BroadcastEntity> & entities);
+
+   // frames the game wrote over while we were copying them, and
+   // frames that came and went between reads
+   long long getTorn()    const { return torn;    }
+   long long getSkipped() const { return skipped; }
+
+private:
+   const BroadcastHeader * pHeader;
+   long long               size;
+   long long               last;     // newest frame read, -1 for none
+   long long               torn;
+   long long               skipped;
+};
+
+#endif // BROADCAST_H
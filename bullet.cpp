@@ -1,4 +1,6 @@
 #include "bullet.h"
+#include "world.h"
+#include "qualityGovernor.h"
 
 /***************************************
 * BULLET :: ADVANCE
@@ -18,26 +20,14 @@ void Bullet::advance()
 	float y = getPosition().getY() +
            (speed + defualtSpeed) * sin((getRotation() + 90) * PI / 180);
 	distance++;
-	if (x < -200)
-           if (type == 0)
-              x = 200;
-           else
-              kill();
-	else if (x > 200)
-           if(type == 0)
-              x = -200;
-           else
-              kill();
-	if (y < -200)
-           if(type == 0)
-              y = 200;
-           else
-              kill();
-	else if (y > 200)
-           if(type == 0)
-              y = -200;
-           else
-              kill();
+	// bullets come around the other side, everything else just fades out
+	if (type == 0)
+	{
+	   World::wrapX(x);
+	   World::wrapY(y);
+	}
+	else if (World::isOutside(Point(x, y)))
+	   kill();
 	setPosition(Point(x, y));
 	if (distance >= 40 && type != 2)
            setLives(0);
@@ -47,7 +37,7 @@ void Bullet::advance()
            if (getLives() <= 0)
               setLives(250);
            if (getLives() <= 103 && getLives() >= 98)
-              setPosition(Point(random(-200, 200), random(-200, 200)));
+              setPosition(World::getRandomPoint());
 	}
 }
 
@@ -64,8 +54,9 @@ void Bullet::draw()
 {
 	if (type == 0)
 	{
-		if (getWeapon() == 0)
-			drawDot(getPosition());
+		// the sprites are expensive and only for show
+		if (getWeapon() == 0 || !QualityGovernor::isSpriteWeapons())
+			batchDot(getPosition(), 1.0, 1.0, 1.0);
 		else if (getWeapon() == 1)
 			drawSacredBird(getPosition(), 10);
 		else if (getWeapon() == 2)
@@ -75,9 +66,7 @@ void Bullet::draw()
 	}
 	else if (type == 1)
 	{
-		changeColor(random(0.5, 0.8), random(0.3, 0.6), 0.0);
-		drawDot(getPosition());
-		changeColor(1, 1, 1);
+		batchDot(getPosition(), random(0.5, 0.8), random(0.3, 0.6), 0.0);
 	}
 	else if (type == 2)
 	{
@@ -86,15 +75,11 @@ void Bullet::draw()
 			num = (getLives() - 100.0) / 100.0;
 		else
 			num = ((getLives() * -1 + 100) / 100.0);
-		changeColor(num, num, num);
-		drawDot(getPosition());
-		changeColor(1, 1, 1);
+		batchDot(getPosition(), num, num, num);
 	}
 	else if (type == 3)
 	{
-		changeColor(0.0, 0.0, random(0.1, 1.0));
-		drawDot(getPosition());
-		changeColor(1, 1, 1);
+		batchDot(getPosition(), 0.0, 0.0, random(0.1, 1.0));
 	}
 }
 
@@ -109,3 +94,41 @@ void Bullet::setWeapon(int weapon)
 		weapon = 0;
 	this->weapon = weapon;
 }
+
+/***************************************
+* BULLET :: EXPLODE
+* Dots flying every which way from where
+* something broke, fewer when frames are
+* running late
+***************************************/
+void Bullet::explode(std::list<Bullet*> & debris, const Point & point,
+                     int size, int type)
+{
+	int count = QualityGovernor::debrisCount(size * 15);
+	for (int i = 0; i < count; i++)
+	{
+		Bullet *pDebris = new Bullet(DECORATION);
+		pDebris->setPosition(point);
+		pDebris->setRotation(random(0, 360));
+		pDebris->setSpeed(random(0.1, 3.0));
+		pDebris->setDistance(random(-10, 10));
+		pDebris->setType(type);
+		debris.push_back(pDebris);
+	}
+}
+
+/***************************************
+* BULLET :: SCATTERSTARS
+***************************************/
+void Bullet::scatterStars(std::list<Bullet*> & stars, int count)
+{
+	for (int i = 0; i < count; i++)
+	{
+		Bullet *pStar = new Bullet(DECORATION);
+		pStar->setSpeed(0);
+		pStar->setPosition(World::getRandomPoint());
+		pStar->setType(2);
+		pStar->setLives(random(30, 250));
+		stars.push_back(pStar);
+	}
+}
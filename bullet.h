@@ -3,7 +3,9 @@
 
 #define BULLET_SPEED 5
 #define BULLET_LIFE 40
+#define BULLET_STARS 100
 
+#include <list>
 #include "flyingObject.h"
 
 /*************************************************************
@@ -13,21 +15,34 @@
 class Bullet : public FlyingObject
 {
 public:
-	Bullet() : distance(0), speed(5), type(0), weapon(0) {}
+	Bullet() : distance(0), speed(5), type(0), weapon(0), owner(-1) {}
+	Bullet(Decoration decoration) : FlyingObject(decoration), distance(0),
+		speed(5), type(0), weapon(0), owner(-1) {}
 	void advance();
 	void draw();
 	float getSpeed() const { return speed; }
 	void setSpeed(float speed) { this->speed = speed; }
 	void setType(int type) { this->type = type; }
+	int getType() const { return type; }
 	int getDistance() const { return distance; }
 	void setDistance(int distance) { this->distance = distance; }
 	void setWeapon(int weapon);
 	int getWeapon() const { return weapon; }
+	// which player fired it, -1 for nobody.  A ship's bullets are
+	// copies of the ship, so they inherit the ship's owner
+	int getOwner() const { return owner; }
+	void setOwner(int owner) { this->owner = owner; }
+	// the dots something this big leaves when it breaks, type 1 or 3
+	static void explode(std::list<Bullet*> & debris, const Point & point,
+	                    int size, int type);
+	// stars scattered over the world
+	static void scatterStars(std::list<Bullet*> & stars, int count);
 private:
 	int distance;
 	float speed;
 	int type;
 	int weapon;
+	int owner;
 };
 
 
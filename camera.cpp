@@ -0,0 +1,101 @@
+/***********************************************************************
+ * Source File:
+ *    Camera : which part of the world is on the screen
+ * Summary:
+ *    Load the 2D projection for the world view or for the screen.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+
+#ifdef __APPLE__
+#include <openGL/gl.h>    // Main OpenGL library
+#include <GLUT/glut.h>    // Second OpenGL library
+#endif // __APPLE__
+
+#ifdef __linux__
+#include <GL/gl.h>        // Main OpenGL library
+#include <GL/glu.h>       // for gluOrtho2D()
+#endif // __linux__
+
+#ifdef _WIN32
+#include <GL/glut.h>      // OpenGL library we copied
+#endif // _WIN32
+
+#include "camera.h"
+#include "world.h"
+
+/******************************************************************
+ * CAMERA : SET SIZE
+ *   INPUT  halfWidth, halfHeight   distance from the center to the edge
+ ****************************************************************/
+void Camera::setSize(float halfWidth, float halfHeight)
+{
+   assert(halfWidth > 0.0 && halfHeight > 0.0);
+   this->halfWidth  = halfWidth;
+   this->halfHeight = halfHeight;
+}
+
+/******************************************************************
+ * CAMERA : SET ZOOM
+ *   INPUT  zoom   world units per screen unit, larger sees more
+ ****************************************************************/
+void Camera::setZoom(float zoom)
+{
+   assert(zoom > 0.0);
+   this->zoom = zoom;
+}
+
+/******************************************************************
+ * CAMERA : FOLLOW
+ * Center on the target, then slide back so the view stays inside
+ * the world.  If the world is narrower than the view in some
+ * direction, center the world in that direction instead.
+ *   INPUT  target   what we want to look at, usually the ship
+ ****************************************************************/
+void Camera::follow(const Point & target)
+{
+   float x = target.getX();
+   float y = target.getY();
+   float halfWidth  = this->halfWidth  * zoom;
+   float halfHeight = this->halfHeight * zoom;
+
+   if (World::getWidth() <= 2.0 * halfWidth)
+      x = (World::getXMin() + World::getXMax()) / 2.0;
+   else if (x - halfWidth < World::getXMin())
+      x = World::getXMin() + halfWidth;
+   else if (x + halfWidth > World::getXMax())
+      x = World::getXMax() - halfWidth;
+
+   if (World::getHeight() <= 2.0 * halfHeight)
+      y = (World::getYMin() + World::getYMax()) / 2.0;
+   else if (y - halfHeight < World::getYMin())
+      y = World::getYMin() + halfHeight;
+   else if (y + halfHeight > World::getYMax())
+      y = World::getYMax() - halfHeight;
+
+   center = Point(x, y);
+}
+
+/******************************************************************
+ * CAMERA : APPLY WORLD
+ * Map the visible part of the world onto the window
+ ****************************************************************/
+void Camera::applyWorld() const
+{
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+   gluOrtho2D(getXMin(), getXMax(), getYMin(), getYMax());
+}
+
+/******************************************************************
+ * CAMERA : APPLY SCREEN
+ * Map a view of the same size, centered on the origin, onto the
+ * window.  Things drawn here stay put when the camera moves.
+ ****************************************************************/
+void Camera::applyScreen() const
+{
+   glMatrixMode(GL_MODELVIEW);
+   glLoadIdentity();
+   gluOrtho2D(getScreenXMin(), getScreenXMax(),
+              getScreenYMin(), getScreenYMax());
+}
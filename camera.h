@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Header File:
+ *    Camera : which part of the world is on the screen
+ * Summary:
+ *    The window shows a view of the world.  The view has its own size,
+ *    set from the window, and its own center, so the world can be much
+ *    larger than what fits on the screen.
+ ************************************************************************/
+
+#ifndef CAMERA_H
+#define CAMERA_H
+
+#include "point.h"
+
+/*********************************************
+ * CAMERA
+ * A rectangle of the world to draw
+ *********************************************/
+class Camera
+{
+public:
+   Camera() : halfWidth(200.0), halfHeight(200.0), zoom(1.0) {}
+
+   // how much of the world fits on the screen
+   void setSize(float halfWidth, float halfHeight);
+
+   // how many world units each unit of the screen shows: 1.0 is normal,
+   // 4.0 shows four times as much of the world across
+   void  setZoom(float zoom);
+   float getZoom() const { return zoom; }
+
+   // how many screen units one world unit covers
+   float getScale() const { return 1.0 / zoom; }
+
+   // where the camera is looking
+   void setCenter(const Point & center) { this->center = center; }
+   Point getCenter() const { return center; }
+
+   // look at the target, but do not show anything past the edge of the
+   // world unless the world is smaller than the view
+   void follow(const Point & target);
+
+   // could something this big at this spot be on the screen?
+   bool isVisible(const Point & pt, float radius) const
+   {
+      return pt.getX() + radius >= getXMin() && pt.getX() - radius <= getXMax() &&
+             pt.getY() + radius >= getYMin() && pt.getY() - radius <= getYMax();
+   }
+
+   // the visible part of the world
+   float getXMin() const { return center.getX() - halfWidth  * zoom; }
+   float getXMax() const { return center.getX() + halfWidth  * zoom; }
+   float getYMin() const { return center.getY() - halfHeight * zoom; }
+   float getYMax() const { return center.getY() + halfHeight * zoom; }
+
+   // the screen is the view without the camera's position or zoom:
+   // (0,0) is the middle of the window no matter where we are looking
+   float getScreenXMin() const { return -halfWidth;  }
+   float getScreenXMax() const { return  halfWidth;  }
+   float getScreenYMin() const { return -halfHeight; }
+   float getScreenYMax() const { return  halfHeight; }
+
+   // set up OpenGL to draw things in world coordinates
+   void applyWorld() const;
+
+   // set up OpenGL to draw things fixed to the screen, such as the HUD
+   void applyScreen() const;
+
+private:
+   Point center;       // the middle of the view, in world coordinates
+   float halfWidth;    // distance from the center to the left and right
+   float halfHeight;   // distance from the center to the top and bottom
+   float zoom;         // world units per screen unit
+};
+
+#endif // CAMERA_H
@@ -0,0 +1,136 @@
+/***********************************************************************
+ * Source File:
+ *    Event Bus : what happened in the game, for whoever wants to know
+ * Summary:
+ *    One writer, any number of readers, each with its own cursor.  The
+ *    writer stamps every slot with the sequence number of the event in
+ *    it, clearing the stamp while it writes.  A reader checks the stamp
+ *    before and after copying; if it changed, the writer lapped it and
+ *    the copy is thrown away.  Readers never write anything shared, so
+ *    adding one costs the simulation nothing.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include "eventBus.h"
+
+using namespace std;
+
+#define EVENT_SLOT_EMPTY  0   // stamp while a slot is being written
+
+/*********************************************
+ * EVENT SLOT
+ * An event and the sequence number it holds,
+ * plus one so that zero can mean "in use"
+ *********************************************/
+struct EventSlot
+{
+   atomic<unsigned long long> stamp;
+   GameEvent                  event;
+};
+
+static EventSlot ring[EVENT_BUS_SIZE];
+static unsigned long long         sequence = 0;   // events published so far
+static atomic<unsigned long long> head(0);       // events readers may see
+
+int  EventBus::frame = 0;
+bool EventBus::muted = false;
+
+/******************************************************************
+ * EVENT BUS : PUBLISH
+ *   INPUT  type     EVENT_*
+ *          pos      where it happened
+ *          tier     what sort of rock, if any
+ *          points   what it scored
+ ****************************************************************/
+void EventBus::publish(int type, const Point & pos, int tier, int points)
+{
+   assert(type >= 0 && type < EVENT_TYPE_COUNT);
+   if (muted)
+      return;
+   EventSlot & slot = ring[sequence & (EVENT_BUS_SIZE - 1)];
+
+   slot.stamp.store(EVENT_SLOT_EMPTY, memory_order_relaxed);
+   atomic_thread_fence(memory_order_release);
+   slot.event.type   = type;
+   slot.event.frame  = frame;
+   slot.event.tier   = tier;
+   slot.event.points = points;
+   slot.event.x      = pos.getX();
+   slot.event.y      = pos.getY();
+   slot.stamp.store(sequence + 1, memory_order_release);
+   sequence++;
+}
+
+/******************************************************************
+ * EVENT BUS : END FRAME
+ * Hand the whole tick over at once
+ ****************************************************************/
+void EventBus::endFrame()
+{
+   head.store(sequence, memory_order_release);
+   frame++;
+}
+
+/******************************************************************
+ * EVENT BUS : GET HEAD
+ ****************************************************************/
+unsigned long long EventBus::getHead()
+{
+   return head.load(memory_order_acquire);
+}
+
+/******************************************************************
+ * EVENT BUS : READ
+ *   INPUT  seq       which event
+ *   OUTPUT event     a copy of it
+ *          <return>  false if the writer has moved on past it
+ ****************************************************************/
+bool EventBus::read(unsigned long long seq, GameEvent & event)
+{
+   const EventSlot & slot = ring[seq & (EVENT_BUS_SIZE - 1)];
+   if (slot.stamp.load(memory_order_acquire) != seq + 1)
+      return false;
+   event = slot.event;
+   atomic_thread_fence(memory_order_acquire);
+   return slot.stamp.load(memory_order_relaxed) == seq + 1;
+}
+
+/******************************************************************
+ * EVENT BUS : TYPE NAME
+ ****************************************************************/
+const char * EventBus::typeName(int type)
+{
+   static const char * names[EVENT_TYPE_COUNT] =
+   {
+      "rock_destroyed", "rock_spawned", "bullet_hit",
+      "ship_killed",    "ship_respawn"
+   };
+   return (type >= 0 && type < EVENT_TYPE_COUNT) ? names[type] : "unknown";
+}
+
+/******************************************************************
+ * EVENT SUBSCRIBER : POLL
+ * Skip ahead if we have been lapped, and skip any event that gets
+ * overwritten while we copy it.
+ *   OUTPUT event     the next event
+ *          <return>  false if there is nothing new
+ ****************************************************************/
+bool EventSubscriber::poll(GameEvent & event)
+{
+   for (;;)
+   {
+      unsigned long long visible = EventBus::getHead();
+      if (cursor >= visible)
+         return false;
+
+      if (visible - cursor > EVENT_BUS_SIZE)
+      {
+         missed += visible - cursor - EVENT_BUS_SIZE;
+         cursor = visible - EVENT_BUS_SIZE;
+      }
+
+      if (EventBus::read(cursor++, event))
+         return true;
+      missed++;
+   }
+}
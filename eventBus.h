@@ -0,0 +1,104 @@
+/***********************************************************************
+ * Header File:
+ *    Event Bus : what happened in the game, for whoever wants to know
+ * Summary:
+ *    The simulation announces rocks breaking, bullets landing, the ship
+ *    dying and coming back.  Anything that cares, scoring, statistics,
+ *    sound, the network, subscribes and reads the stream on its own
+ *    thread.  The simulation never waits for a subscriber: events go
+ *    into a ring, and a subscriber that falls a whole ring behind
+ *    loses the oldest ones and is told how many.
+ *
+ *    Events published during a tick become visible all at once when
+ *    the tick ends, so a subscriber always sees whole frames.
+ ************************************************************************/
+
+#ifndef EVENT_BUS_H
+#define EVENT_BUS_H
+
+#include <atomic>
+#include "point.h"
+
+#define EVENT_BUS_SIZE  1024   // must be a power of two
+
+#define EVENT_ROCK_DESTROYED  0   // a rock was shot or rammed
+#define EVENT_ROCK_SPAWNED    1   // a rock appeared, whole or as a piece
+#define EVENT_BULLET_HIT      2   // a bullet struck a rock
+#define EVENT_SHIP_KILLED     3   // the ship hit a rock
+#define EVENT_SHIP_RESPAWN    4   // the ship came back
+#define EVENT_TYPE_COUNT      5
+
+/*********************************************
+ * GAME EVENT
+ * One thing that happened, small enough to copy
+ *********************************************/
+struct GameEvent
+{
+   int   type;     // EVENT_*
+   int   frame;    // the tick it happened in
+   int   tier;     // ROCK_* for rock events, -1 otherwise
+   int   points;   // score it earned
+   float x;        // where it happened
+   float y;
+};
+
+/*********************************************
+ * EVENT BUS
+ * There is one game, so everything is static.
+ * publish() and endFrame() belong to the
+ * simulation thread; subscribers read from
+ * any thread.
+ *********************************************/
+class EventBus
+{
+public:
+   // simulation: announce an event.  It is not seen until endFrame()
+   static void publish(int type, const Point & pos, int tier = -1,
+                       int points = 0);
+
+   // simulation: let subscribers see everything published this tick
+   static void endFrame();
+
+   static int getFrame() { return frame; }
+
+   // simulation: while muted, publish() does nothing.  Ticks played a
+   // second time after a rollback have already been announced
+   static void setMuted(bool muted) { EventBus::muted = muted; }
+
+   // the sequence number the next visible event will get
+   static unsigned long long getHead();
+
+   // copy event number seq.  Returns false if it has already been
+   // overwritten by a newer one
+   static bool read(unsigned long long seq, GameEvent & event);
+
+   static const char * typeName(int type);
+
+private:
+   static int  frame;
+   static bool muted;
+};
+
+/*********************************************
+ * EVENT SUBSCRIBER
+ * One reader's place in the stream.  Starts at
+ * whatever is published next.  Only the thread
+ * that owns it may poll.
+ *********************************************/
+class EventSubscriber
+{
+public:
+   EventSubscriber() : cursor(EventBus::getHead()), missed(0) {}
+
+   // take the next event.  Returns false when caught up
+   bool poll(GameEvent & event);
+
+   // events lost because we fell too far behind
+   unsigned long long getMissed() const { return missed; }
+
+private:
+   unsigned long long cursor;   // next event we read
+   unsigned long long missed;
+};
+
+#endif // EVENT_BUS_H
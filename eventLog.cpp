@@ -0,0 +1,82 @@
+/***********************************************************************
+ * Source File:
+ *    Event Log : write the game's events to a file as they happen
+ * Summary:
+ *    The thread polls its subscription and naps when there is nothing
+ *    new.  The simulation does not know it is here.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "eventLog.h"
+#include "eventBus.h"
+
+using namespace std;
+
+#define EVENT_LOG_NAP_MS  10   // how long the thread sleeps when idle
+
+static ofstream     out;
+static thread       logger;
+static atomic<bool> running(false);
+
+bool EventLog::active = false;
+
+/******************************************************************
+ * LOGGER
+ * Write events until stopped, then once more to catch the last ones
+ ****************************************************************/
+static void loggerMain(EventSubscriber * pSubscriber)
+{
+   GameEvent event;
+   bool more = true;
+   while (more)
+   {
+      more = running.load();
+      while (pSubscriber->poll(event))
+         out << event.frame << ' ' << EventBus::typeName(event.type) << ' '
+             << event.tier << ' ' << event.x << ' ' << event.y << ' '
+             << event.points << '\n';
+      if (more)
+         this_thread::sleep_for(chrono::milliseconds(EVENT_LOG_NAP_MS));
+   }
+
+   if (pSubscriber->getMissed())
+      out << "# missed " << pSubscriber->getMissed() << " events\n";
+   delete pSubscriber;
+}
+
+/******************************************************************
+ * EVENT LOG : START
+ *   INPUT  path      where to write
+ *   OUTPUT <return>  false if the file could not be opened
+ ****************************************************************/
+bool EventLog::start(const char * path)
+{
+   assert(!active);
+   out.open(path);
+   if (!out.is_open())
+      return false;
+   out << "# frame type tier x y points\n";
+
+   running = true;
+   logger = thread(loggerMain, new EventSubscriber);
+   active = true;
+   return true;
+}
+
+/******************************************************************
+ * EVENT LOG : STOP
+ ****************************************************************/
+void EventLog::stop()
+{
+   if (!active)
+      return;
+   active = false;
+
+   running = false;
+   logger.join();
+   out.close();
+}
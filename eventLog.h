@@ -0,0 +1,34 @@
+/***********************************************************************
+ * Header File:
+ *    Event Log : write the game's events to a file as they happen
+ * Summary:
+ *    A subscriber to the event bus living on its own thread.  Each
+ *    event becomes one line of text:
+ *       frame type tier x y points
+ *    so a run can be picked apart afterwards with ordinary tools.
+ ************************************************************************/
+
+#ifndef EVENT_LOG_H
+#define EVENT_LOG_H
+
+/*********************************************
+ * EVENT LOG
+ * One log per run, so everything is static
+ *********************************************/
+class EventLog
+{
+public:
+   // open the file and start reading the bus.  Returns false if the
+   // file could not be opened
+   static bool start(const char * path);
+
+   // catch up, note anything missed, and close the file
+   static void stop();
+
+   static bool isActive() { return active; }
+
+private:
+   static bool active;
+};
+
+#endif // EVENT_LOG_H
@@ -1 +1,3 @@
 #include "flyingObject.h"
+
+unsigned int FlyingObject::nextId = 1;
@@ -15,7 +15,31 @@
 class FlyingObject
 {
 public:
-	FlyingObject() : rotation(0), lives(1) {}
+	FlyingObject() : lives(1), rotation(0), id(nextId++) {}
+	// eye candy is never sent anywhere and comes and goes with the
+	// frame rate, so it takes no id.  The simulation's ids then come
+	// out the same however the game is drawn or played again
+	enum Decoration { DECORATION };
+	FlyingObject(Decoration) : lives(1), rotation(0), id(0) {}
+	// a copy is a new object, so it gets its own id
+	FlyingObject(const FlyingObject & rhs) : lives(rhs.lives), velocity(rhs.velocity),
+		pos(rhs.pos), size(rhs.size), rotation(rhs.rotation), id(nextId++) {}
+	FlyingObject & operator = (const FlyingObject & rhs)
+	{
+		lives = rhs.lives;
+		velocity = rhs.velocity;
+		pos = rhs.pos;
+		size = rhs.size;
+		rotation = rhs.rotation;
+		return *this;
+	}
+	// tells this object from every other one ever made, so a client
+	// can follow it from one snapshot to the next
+	unsigned int getId() const { return id; }
+	// only for putting a saved object back just as it was, id and all
+	void setId(unsigned int id) { this->id = id; }
+	static unsigned int getNextId() { return nextId; }
+	static void setNextId(unsigned int id) { nextId = id; }
 	void setLives(int lives) { this->lives = lives; }
 	int getLives() const { return lives; }
 	bool isAlive() const { return lives; }
@@ -34,6 +58,8 @@ private:
 	Point pos;
 	int size;
 	int rotation;
+	unsigned int id;
+	static unsigned int nextId;
 };
 
 
@@ -0,0 +1,397 @@
+/***********************************************************************
+ * Source File:
+ *    Frame Capture : record every frame to disk
+ * Summary:
+ *    The drawing thread fills a ring of preallocated slots and the
+ *    writer thread empties it, the same single-producer single-consumer
+ *    arrangement as the input queue.  Neither side ever waits on the
+ *    other: the producer drops when the ring is full, the consumer naps
+ *    when it is empty.  Turning the picture right side up and converting
+ *    it to YUV both happen on the writer thread.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstdio>     // for snprintf()
+#include <cstddef>    // for ptrdiff_t
+#include <cstring>    // for memcpy() and strrchr()
+#include <fstream>    // where the frames go
+#include <vector>
+#include <string>
+#include <atomic>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+#ifdef __APPLE__
+#include <openGL/gl.h>    // Main OpenGL library
+#include <GLUT/glut.h>    // Second OpenGL library
+#endif // __APPLE__
+
+#ifdef __linux__
+#include <GL/gl.h>            // Main OpenGL library
+#include <GL/glut.h>          // Second OpenGL library
+#endif // __linux__
+
+#ifdef _WIN32
+#include <Windows.h>
+#include <GL/glut.h>      // OpenGL library we copied
+#endif // _WIN32
+
+#include "frameCapture.h"
+#include "uiDraw.h"       // for getGLProc() and getGLVersion()
+
+using namespace std;
+
+#define CAPTURE_PPM   0   // a numbered file per frame
+#define CAPTURE_RAW   1   // RGB24 frames back to back
+#define CAPTURE_Y4M   2   // YUV4MPEG2 stream
+
+#define CAPTURE_NAP_MS  10   // how long the writer sleeps when idle
+
+// OpenGL 1.1 headers do not know about buffer objects
+#ifndef GL_PIXEL_PACK_BUFFER
+#define GL_PIXEL_PACK_BUFFER  0x88EB
+#endif
+#ifndef GL_STREAM_READ
+#define GL_STREAM_READ        0x88E1
+#endif
+#ifndef GL_READ_ONLY
+#define GL_READ_ONLY          0x88B8
+#endif
+#ifndef APIENTRY
+#define APIENTRY
+#endif
+
+typedef void   (APIENTRY * GenBuffersProc)(GLsizei, GLuint *);
+typedef void   (APIENTRY * BindBufferProc)(GLenum, GLuint);
+typedef void   (APIENTRY * BufferDataProc)(GLenum, ptrdiff_t, const void *, GLenum);
+typedef void * (APIENTRY * MapBufferProc)(GLenum, GLenum);
+typedef GLboolean (APIENTRY * UnmapBufferProc)(GLenum);
+
+/*********************************************
+ * CAPTURE STATE
+ * Everything both threads share
+ *********************************************/
+static int    format = CAPTURE_PPM;
+static string capturePath;          // file, or prefix for PPM
+static int    frameWidth  = 0;
+static int    frameHeight = 0;
+static size_t frameBytes = 0;       // width * height * 3
+
+static vector<unsigned char> slots[FRAME_CAPTURE_SLOTS];
+static atomic<long long> head(0);   // next slot the drawing thread fills
+static atomic<long long> tail(0);   // next slot the writer empties
+static atomic<long long> captured(0);
+static atomic<long long> written(0);
+static atomic<long long> dropped(0);
+static atomic<bool>      running(false);
+
+static thread             writer;
+static mutex              napLock;
+static condition_variable wakeUp;
+static ofstream           stream;   // for RAW and Y4M
+
+/*********************************************
+ * PIXEL BUFFERS
+ * Only touched by the drawing thread
+ *********************************************/
+static GenBuffersProc    genBuffers    = NULL;
+static BindBufferProc    bindBuffer    = NULL;
+static BufferDataProc    bufferData    = NULL;
+static MapBufferProc     mapBuffer     = NULL;
+static UnmapBufferProc   unmapBuffer   = NULL;
+static GLuint    pbo[2] = { 0, 0 };
+static long long grabs  = 0;        // frames read back so far
+
+bool FrameCapture::active = false;
+
+/******************************************************************
+ * CREATE PIXEL BUFFERS
+ * Two pixel pack buffers, one being filled while the other is read.
+ * Leaves pbo[0] at zero if the driver cannot do it.
+ ****************************************************************/
+static void createPixelBuffers()
+{
+   // without a loader there are no pointers: read back synchronously
+   genBuffers    = (GenBuffersProc)   getGLProc("glGenBuffers");
+   bindBuffer    = (BindBufferProc)   getGLProc("glBindBuffer");
+   bufferData    = (BufferDataProc)   getGLProc("glBufferData");
+   mapBuffer     = (MapBufferProc)    getGLProc("glMapBuffer");
+   unmapBuffer   = (UnmapBufferProc)  getGLProc("glUnmapBuffer");
+   if (!genBuffers || !bindBuffer || !bufferData ||
+       !mapBuffer  || !unmapBuffer)
+      return;
+
+   // pixel pack buffers came with 2.1
+   if (getGLVersion() < 21)
+      return;
+
+   genBuffers(2, pbo);
+   for (int i = 0; i < 2; i++)
+   {
+      bindBuffer(GL_PIXEL_PACK_BUFFER, pbo[i]);
+      bufferData(GL_PIXEL_PACK_BUFFER, (ptrdiff_t)frameBytes, NULL,
+                 GL_STREAM_READ);
+   }
+   bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+}
+
+/******************************************************************
+ * ACQUIRE SLOT
+ * The next empty slot, or NULL if the writer has all of them
+ ****************************************************************/
+static unsigned char * acquireSlot()
+{
+   long long h = head.load(memory_order_relaxed);
+   if (h - tail.load(memory_order_acquire) >= FRAME_CAPTURE_SLOTS)
+   {
+      dropped++;
+      return NULL;
+   }
+   return &slots[h % FRAME_CAPTURE_SLOTS][0];
+}
+
+/******************************************************************
+ * PUBLISH SLOT
+ * The slot from acquireSlot() is filled: give it to the writer
+ ****************************************************************/
+static void publishSlot()
+{
+   head.store(head.load(memory_order_relaxed) + 1, memory_order_release);
+   wakeUp.notify_one();
+}
+
+/******************************************************************
+ * WRITE FRAME
+ * Writer thread: one bottom-up RGB frame to the output
+ *   INPUT  pixels   the frame
+ *          number   which frame it is, for the PPM file name
+ *          yuv      scratch space for the Y4M planes
+ *   OUTPUT <return> false if the output would not take it
+ ****************************************************************/
+static bool writeFrame(const unsigned char * pixels, long long number,
+                       vector<unsigned char> & yuv)
+{
+   size_t row = (size_t)frameWidth * 3;
+
+   if (format == CAPTURE_PPM)
+   {
+      char name[1024];
+      snprintf(name, sizeof(name), "%s_%06lld.ppm",
+               capturePath.c_str(), number);
+      ofstream fout(name, ios::binary);
+      fout << "P6\n" << frameWidth << " " << frameHeight << "\n255\n";
+      for (int y = frameHeight - 1; y >= 0; y--)
+         fout.write((const char *)pixels + y * row, row);
+      return fout.good();
+   }
+
+   if (format == CAPTURE_RAW)
+   {
+      for (int y = frameHeight - 1; y >= 0; y--)
+         stream.write((const char *)pixels + y * row, row);
+      return stream.good();
+   }
+
+   // Y4M: BT.601 studio range, one full sized plane each for Y, U and V
+   size_t plane = (size_t)frameWidth * frameHeight;
+   yuv.resize(plane * 3);
+   size_t i = 0;
+   for (int y = frameHeight - 1; y >= 0; y--)
+      for (int x = 0; x < frameWidth; x++, i++)
+      {
+         const unsigned char * p = pixels + y * row + x * 3;
+         int r = p[0];
+         int g = p[1];
+         int b = p[2];
+         yuv[i]             = (unsigned char)(( 66 * r + 129 * g +  25 * b + 128) / 256 + 16);
+         yuv[i + plane]     = (unsigned char)((-38 * r -  74 * g + 112 * b + 128) / 256 + 128);
+         yuv[i + plane * 2] = (unsigned char)((112 * r -  94 * g -  18 * b + 128) / 256 + 128);
+      }
+   stream << "FRAME\n";
+   stream.write((const char *)&yuv[0], yuv.size());
+   return stream.good();
+}
+
+/******************************************************************
+ * WRITER
+ * The background thread: write whatever is waiting, nap when there
+ * is nothing, and quit once stopped and caught up
+ ****************************************************************/
+static void writerMain()
+{
+   vector<unsigned char> yuv;
+   long long number = 0;
+
+   for (;;)
+   {
+      long long t = tail.load(memory_order_relaxed);
+      if (t == head.load(memory_order_acquire))
+      {
+         if (!running.load())
+            break;
+         unique_lock<mutex> lock(napLock);
+         wakeUp.wait_for(lock, chrono::milliseconds(CAPTURE_NAP_MS));
+         continue;
+      }
+
+      if (writeFrame(&slots[t % FRAME_CAPTURE_SLOTS][0], number++, yuv))
+         written++;
+      else
+         dropped++;
+      tail.store(t + 1, memory_order_release);
+   }
+}
+
+/******************************************************************
+ * FRAME CAPTURE : START
+ *   INPUT  path     where to write, the extension picks the format
+ *          width    size of the frames
+ *          height
+ *          fps      frame rate, for the Y4M header
+ *   OUTPUT <return> false if the output could not be opened
+ ****************************************************************/
+bool FrameCapture::start(const char * path, int width, int height,
+                         double fps)
+{
+   assert(!active);
+   assert(width > 0 && height > 0);
+   capturePath = path;
+   frameWidth  = width;
+   frameHeight = height;
+   frameBytes = (size_t)width * height * 3;
+
+   const char * dot = strrchr(path, '.');
+   if (dot && strcmp(dot, ".y4m") == 0)
+      format = CAPTURE_Y4M;
+   else if (dot && strcmp(dot, ".raw") == 0)
+      format = CAPTURE_RAW;
+   else
+      format = CAPTURE_PPM;
+
+   if (format != CAPTURE_PPM)
+   {
+      stream.open(path, ios::binary);
+      if (!stream.is_open())
+         return false;
+      if (format == CAPTURE_Y4M)
+         stream << "YUV4MPEG2 W" << width << " H" << height
+                << " F" << (long long)(fps * 1000.0 + 0.5) << ":1000"
+                << " Ip A1:1 C444\n";
+   }
+
+   for (int i = 0; i < FRAME_CAPTURE_SLOTS; i++)
+      slots[i].resize(frameBytes);
+
+   createPixelBuffers();
+
+   running = true;
+   writer = thread(writerMain);
+   active = true;
+   return true;
+}
+
+/******************************************************************
+ * FRAME CAPTURE : STOP
+ * The frame still in a pixel buffer is lost: collecting it would
+ * need the OpenGL context, which may already be gone
+ ****************************************************************/
+void FrameCapture::stop()
+{
+   if (!active)
+      return;
+   active = false;
+
+   running = false;
+   wakeUp.notify_one();
+   writer.join();
+   if (stream.is_open())
+      stream.close();
+}
+
+/******************************************************************
+ * FRAME CAPTURE : GRAB
+ * Start reading this frame into one pixel buffer, then collect last
+ * frame from the other.  Without pixel buffers read this frame
+ * straight into a slot.
+ ****************************************************************/
+void FrameCapture::grab()
+{
+   if (!active)
+      return;
+   captured++;
+   glPixelStorei(GL_PACK_ALIGNMENT, 1);
+
+   if (pbo[0] == 0)
+   {
+      unsigned char * slot = acquireSlot();
+      if (slot == NULL)
+         return;
+      glReadPixels(0, 0, frameWidth, frameHeight, GL_RGB, GL_UNSIGNED_BYTE, slot);
+      publishSlot();
+      return;
+   }
+
+   int current = (int)(grabs % 2);
+   bindBuffer(GL_PIXEL_PACK_BUFFER, pbo[current]);
+   glReadPixels(0, 0, frameWidth, frameHeight, GL_RGB, GL_UNSIGNED_BYTE, 0);
+
+   // last frame has had a whole frame to arrive
+   if (grabs > 0)
+   {
+      bindBuffer(GL_PIXEL_PACK_BUFFER, pbo[1 - current]);
+      unsigned char * slot = acquireSlot();
+      if (slot != NULL)
+      {
+         const void * pixels = mapBuffer(GL_PIXEL_PACK_BUFFER, GL_READ_ONLY);
+         if (pixels != NULL)
+         {
+            memcpy(slot, pixels, frameBytes);
+            unmapBuffer(GL_PIXEL_PACK_BUFFER);
+            publishSlot();
+         }
+         else
+            dropped++;
+      }
+   }
+   bindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+   grabs++;
+}
+
+/******************************************************************
+ * FRAME CAPTURE : SUBMIT
+ *   INPUT  pixels   width * height * 3 bytes, bottom row first
+ ****************************************************************/
+void FrameCapture::submit(const unsigned char * pixels)
+{
+   if (!active)
+      return;
+   captured++;
+   unsigned char * slot = acquireSlot();
+   if (slot == NULL)
+      return;
+   memcpy(slot, pixels, frameBytes);
+   publishSlot();
+}
+
+/******************************************************************
+ * FRAME CAPTURE : COUNTERS
+ ****************************************************************/
+long long FrameCapture::getCaptured() { return captured.load(); }
+long long FrameCapture::getWritten()  { return written.load();  }
+long long FrameCapture::getDropped()  { return dropped.load();  }
+bool      FrameCapture::isAsync()     { return pbo[0] != 0;     }
+
+/******************************************************************
+ * FRAME CAPTURE : REPORT
+ *   INPUT  out   where to write the summary
+ ****************************************************************/
+void FrameCapture::report(ostream & out)
+{
+   out << "Capture: " << capturePath << " " << frameWidth << "x" << frameHeight
+       << (isAsync() ? " (pixel buffers)" : " (synchronous readback)") << "\n"
+       << "   frames captured " << getCaptured()
+       << ", written " << getWritten()
+       << ", dropped " << getDropped() << "\n";
+}
@@ -0,0 +1,73 @@
+/***********************************************************************
+ * Header File:
+ *    Frame Capture : record every frame to disk
+ * Summary:
+ *    Reads each finished frame back from OpenGL and hands it to a
+ *    background thread that writes it out, so recording never holds up
+ *    the game.  The readback goes through two pixel buffer objects when
+ *    the driver has them: this frame's copy is started while last
+ *    frame's, by now finished, is collected.  Without them it falls back
+ *    to an ordinary glReadPixels().  Frames can also be handed over
+ *    directly by anything that already has the pixels in memory.
+ *
+ *    If the writer falls behind and every slot is full the frame is
+ *    dropped, never waited for, and counted.
+ *
+ *    The format comes from the file name:
+ *       name.y4m   one YUV4MPEG2 stream (4:4:4), plays in most tools
+ *       name.raw   one stream of RGB24 frames, top row first
+ *       name       a sequence of name_000000.ppm, name_000001.ppm, ...
+ ************************************************************************/
+
+#ifndef FRAME_CAPTURE_H
+#define FRAME_CAPTURE_H
+
+#include <iostream>
+
+#define FRAME_CAPTURE_SLOTS  8   // frames waiting for the writer
+
+/*********************************************
+ * FRAME CAPTURE
+ * There is only one screen, so everything is
+ * static.  grab() and submit() belong to the
+ * drawing thread; the writing happens on a
+ * thread of its own.
+ *********************************************/
+class FrameCapture
+{
+public:
+   // start recording frames of this size to this path.  Must be called
+   // with the OpenGL context current.  Returns false if the output could
+   // not be opened
+   static bool start(const char * path, int width, int height, double fps);
+
+   // wait for the writer to finish what it has and close the output.
+   // Does not touch OpenGL, so it is safe from atexit()
+   static void stop();
+
+   static bool isActive() { return active; }
+
+   // read the frame just drawn out of the back buffer
+   static void grab();
+
+   // take a frame someone else has rendered: width * height RGB bytes,
+   // bottom row first, the way glReadPixels() delivers it
+   static void submit(const unsigned char * pixels);
+
+   // frames offered, frames written, and frames lost because the writer
+   // was behind or the disk said no
+   static long long getCaptured();
+   static long long getWritten();
+   static long long getDropped();
+
+   // was the driver able to give us pixel buffer objects?
+   static bool isAsync();
+
+   // what happened, for the end of the run
+   static void report(std::ostream & out);
+
+private:
+   static bool active;
+};
+
+#endif // FRAME_CAPTURE_H
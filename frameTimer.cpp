@@ -0,0 +1,208 @@
+/***********************************************************************
+ * Source File:
+ *    Frame Timer : pace the frames against a monotonic clock
+ * Summary:
+ *    Implement the pacer and histogram described in frameTimer.h.  The
+ *    only platform specific code is reading the clock and sleeping.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+
+#ifdef _WIN32
+#include <Windows.h>  // QueryPerformanceCounter() and ::Sleep()
+#else // LINUX, XCODE
+#include <time.h>     // clock_gettime() and nanosleep()
+#include <errno.h>
+#endif
+
+#include "frameTimer.h"
+
+/******************************************************************
+ * MONOTONIC NOW
+ * The current time in nanoseconds from an arbitrary starting point.
+ ****************************************************************/
+long long monotonicNow()
+{
+#ifdef _WIN32
+   static LARGE_INTEGER frequency = {};
+   if (frequency.QuadPart == 0)
+      QueryPerformanceFrequency(&frequency);
+
+   LARGE_INTEGER now;
+   QueryPerformanceCounter(&now);
+
+   // split the division so we do not overflow on long uptimes
+   long long seconds = now.QuadPart / frequency.QuadPart;
+   long long rest    = now.QuadPart % frequency.QuadPart;
+   return seconds * 1000000000LL + rest * 1000000000LL / frequency.QuadPart;
+#else // LINUX, XCODE
+   timespec now;
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   return (long long)now.tv_sec * 1000000000LL + now.tv_nsec;
+#endif
+}
+
+/******************************************************************
+ * SLEEP FOR
+ * Pause for a while.  We tell the OS that we are idle rather than
+ * burning the CPU.  The OS is allowed to wake us up late, which is
+ * why the pacer spins for the very end of the frame.
+ *   INPUT: ns: sleep time in nanoseconds
+ ****************************************************************/
+void sleepFor(long long ns)
+{
+   if (ns <= 0)
+      return;
+
+#ifdef _WIN32
+   ::Sleep((DWORD)(ns / 1000000LL));
+#else // LINUX, XCODE
+   timespec req;
+   req.tv_sec  = (time_t)(ns / 1000000000LL);
+   req.tv_nsec = (long)(ns % 1000000000LL);
+
+   // keep sleeping the remaining time if a signal woke us up
+   while (nanosleep(&req, &req) == -1 && errno == EINTR)
+      ;
+#endif
+}
+
+/******************************************************************
+ * FRAME HISTOGRAM :: RESET
+ * Forget every sample
+ ****************************************************************/
+void FrameHistogram::reset()
+{
+   for (int i = 0; i <= HISTOGRAM_BUCKETS; i++)
+      buckets[i] = 0;
+   count = 0;
+   maxNs = 0;
+}
+
+/******************************************************************
+ * FRAME HISTOGRAM :: RECORD
+ * Drop one duration into its bucket.  Anything longer than the
+ * histogram covers goes in the overflow bucket at the end.
+ *   INPUT: ns: the duration in nanoseconds
+ ****************************************************************/
+void FrameHistogram::record(long long ns)
+{
+   if (ns < 0)
+      ns = 0;
+
+   long long bucket = ns / HISTOGRAM_BUCKET_NS;
+   if (bucket > HISTOGRAM_BUCKETS)
+      bucket = HISTOGRAM_BUCKETS;
+
+   buckets[bucket]++;
+   count++;
+   if (ns > maxNs)
+      maxNs = ns;
+}
+
+/******************************************************************
+ * FRAME HISTOGRAM :: PERCENTILE
+ * Walk the buckets until we have seen the requested fraction of
+ * the samples.  We report the top of that bucket, so the answer is
+ * never optimistic by more than one bucket width.
+ *   INPUT:  fraction: 0.5 for the median, 0.99 for p99
+ *   OUTPUT: <return>: the duration in nanoseconds
+ ****************************************************************/
+long long FrameHistogram::percentile(double fraction) const
+{
+   assert(fraction >= 0.0 && fraction <= 1.0);
+   if (count == 0)
+      return 0;
+
+   long long target = (long long)(fraction * count + 0.5);
+   if (target < 1)
+      target = 1;
+
+   long long seen = 0;
+   for (int i = 0; i < HISTOGRAM_BUCKETS; i++)
+   {
+      seen += buckets[i];
+      if (seen >= target)
+      {
+         long long top = (long long)(i + 1) * HISTOGRAM_BUCKET_NS;
+         return top < maxNs ? top : maxNs;
+      }
+   }
+
+   // it is in the overflow bucket: the best we can say is the max
+   return maxNs;
+}
+
+/******************************************************************
+ * FRAME PACER : CONSTRUCTOR
+ * Default to 30 frames per second and draw right away
+ ****************************************************************/
+FramePacer::FramePacer() : period(1000000000LL / 30),
+                           nextTick(0),
+                           lastFrame(0),
+                           workStart(0),
+                           lastWorkTime(0),
+                           recentFrameTime(1000000000LL / 30)
+{
+}
+
+/******************************************************************
+ * FRAME PACER : SET FRAMES PER SECOND
+ * The frames per second dictates the speed of the game.
+ *    INPUT  value        The number of frames per second.
+ ****************************************************************/
+void FramePacer::setFramesPerSecond(double value)
+{
+   assert(value > 0.0);
+   period = (long long)(1000000000.0 / value);
+}
+
+/******************************************************************
+ * FRAME PACER : WAIT
+ * Sleep through most of the remaining time, then spin for the last
+ * FRAME_SPIN_NS.  Sleeping keeps the CPU free; spinning keeps us from
+ * being late when the OS wakes us up a millisecond or two after we
+ * asked it to.
+ ****************************************************************/
+void FramePacer::wait() const
+{
+   long long remaining = nextTick - monotonicNow();
+   if (remaining > FRAME_SPIN_NS)
+      sleepFor(remaining - FRAME_SPIN_NS);
+
+   while (monotonicNow() < nextTick)
+      ;
+}
+
+/******************************************************************
+ * FRAME PACER : SET NEXT DRAW TIME
+ * A frame just went out.  Record how long it has been since the last
+ * one and set the next deadline one period after the current one so
+ * small errors do not add up.  If we fell more than a whole frame
+ * behind, start over from now rather than rushing to catch up.
+ ****************************************************************/
+void FramePacer::setNextDrawTime()
+{
+   long long now = monotonicNow();
+
+   if (lastFrame != 0)
+   {
+      frameTimes.record(now - lastFrame);
+      recentFrameTime += (now - lastFrame - recentFrameTime) / 8;
+   }
+   lastFrame = now;
+
+   nextTick += period;
+   if (nextTick < now)
+      nextTick = now + period;
+}
+
+/******************************************************************
+ * FRAME PACER : RESET STATISTICS
+ * Start the histograms fresh, such as after loading is done
+ ****************************************************************/
+void FramePacer::resetStatistics()
+{
+   frameTimes.reset();
+   workTimes.reset();
+}
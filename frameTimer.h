@@ -0,0 +1,115 @@
+/***********************************************************************
+ * Header File:
+ *    Frame Timer : pace the frames against a monotonic clock
+ * Summary:
+ *    Everything we need to put frames on the screen at a steady rate.
+ *    The pacer sleeps for most of the remaining frame and then spins for
+ *    the last little bit so we wake up right on the deadline.  Every
+ *    frame is recorded in a histogram so we can ask how steady we were.
+ ************************************************************************/
+
+#ifndef FRAME_TIMER_H
+#define FRAME_TIMER_H
+
+#define HISTOGRAM_BUCKETS      1000     // number of buckets in a histogram
+#define HISTOGRAM_BUCKET_NS    100000   // each bucket is 0.1 milliseconds
+#define FRAME_SPIN_NS          2000000  // spin for the last 2 milliseconds
+
+/******************************************************************
+ * MONOTONIC NOW
+ * The current time in nanoseconds.  This clock never jumps backwards
+ * and keeps counting while we sleep, unlike clock()
+ ****************************************************************/
+long long monotonicNow();
+
+/******************************************************************
+ * SLEEP FOR
+ * Put the thread to sleep for about the given number of nanoseconds
+ ****************************************************************/
+void sleepFor(long long ns);
+
+/*********************************************
+ * FRAME HISTOGRAM
+ * A fixed-size histogram of durations.  Recording
+ * never allocates so it is safe to do every frame.
+ *********************************************/
+class FrameHistogram
+{
+public:
+   FrameHistogram() { reset(); }
+
+   // forget everything we have seen
+   void reset();
+
+   // add one duration in nanoseconds
+   void record(long long ns);
+
+   // the duration (ns) that the given fraction of samples fall under
+   long long percentile(double fraction) const;
+   long long getP50()   const { return percentile(0.50); }
+   long long getP99()   const { return percentile(0.99); }
+   long long getMax()   const { return maxNs;            }
+   long long getCount() const { return count;            }
+
+private:
+   unsigned int buckets[HISTOGRAM_BUCKETS + 1]; // last one is overflow
+   long long count;                             // samples recorded
+   long long maxNs;                             // longest sample
+};
+
+/*********************************************
+ * FRAME PACER
+ * Decides when the next frame should go on the
+ * screen and waits until then.
+ *********************************************/
+class FramePacer
+{
+public:
+   FramePacer();
+
+   // how many frames per second we are aiming for
+   void   setFramesPerSecond(double value);
+   double getPeriod() const { return period / 1000000000.0; }
+
+   // is the deadline already here?
+   bool isTimeToDraw() const { return monotonicNow() >= nextTick; }
+
+   // sleep, then spin, until the deadline
+   void wait() const;
+
+   // the frame has been presented: schedule the next one
+   void setNextDrawTime();
+
+   // bracket the work done by the client so we know how busy we are
+   void beginWork()   { workStart = monotonicNow(); }
+   void endWork()
+   {
+      lastWorkTime = monotonicNow() - workStart;
+      workTimes.record(lastWorkTime);
+   }
+
+   // how long the most recent frame's work took
+   long long getLastWorkTime() const { return lastWorkTime; }
+
+   long long getNextTick() const { return nextTick; }
+
+   // a smoothed frame-to-frame interval, good for an FPS counter
+   long long getRecentFrameTime() const { return recentFrameTime; }
+
+   // frame-to-frame intervals and time spent doing the work
+   const FrameHistogram & getFrameTimes() const { return frameTimes; }
+   const FrameHistogram & getWorkTimes()  const { return workTimes;  }
+   void resetStatistics();
+
+private:
+   long long period;          // nanoseconds between frames
+   long long nextTick;        // when the next frame is due
+   long long lastFrame;       // when the last frame went out
+   long long workStart;       // when the current frame's work began
+   long long lastWorkTime;    // how long the last frame's work took
+   long long recentFrameTime; // moving average of the frame interval
+   FrameHistogram frameTimes; // interval between presented frames
+   FrameHistogram workTimes;  // time spent in the client callback
+};
+
+#endif // FRAME_TIMER_H
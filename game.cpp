@@ -9,13 +9,33 @@
  *********************************************************************/
 
 #include "game.h"
+#include "options.h"
+#include "allocTracker.h"
+#include "qualityGovernor.h"
+#include "frameCapture.h"
+#include "eventLog.h"
+#include "metrics.h"
+#include "trace.h"
+#include "perfCounters.h"
+#include "benchmark.h"
+#include "lockstep.h"
+#include "rollback.h"
+#include "server.h"
+#include "netClient.h"
+#include "broadcast.h"
+#include "replay.h"
+#include "simRandom.h"
+#include "frameTimer.h"   // for sleepFor() and FramePacer
 #include <limits>
+#include <cassert>    // I feel the need... the need for asserts
+#include <algorithm>  // for sort()
+#include <cstdlib>
+#include <cstring>    // for memcpy()
+#include <ctime>      // for time()
 
-#define WINDOW_X_SIZE 200
-#define WINDOW_Y_SIZE 200
-
-Point Game :: topLeft;
-Point Game :: bottomRight;
+#define WINDOW_X_SIZE 200   // half the width of the window
+#define WINDOW_Y_SIZE 200   // half the height of the window
+#define REPLAY_JUMP_TICKS 300   // how far the arrows move a replay
 
 /***************************************
 * GAME :: MIN
@@ -38,34 +58,64 @@ float Game::max(float d1, float d2) const
 /***************************************
  * GAME :: getRandomPoint
  * Gets a random point within the boundaries of the world.
+ * Rocks start there, so it comes from the simulation's
+ * numbers.
  ***************************************/
 Point Game :: getRandomPoint() const
 {
-   int x = random(topLeft.getX(), bottomRight.getX());
-   int y = random(bottomRight.getY(), topLeft.getY());
-   Point p(x, y);  
-   return p;
+   return World::getSpawnPoint();
 }
 
 
+/***************************************
+ * GAME :: DESTRUCTOR
+ * Only the benchmark makes more than one
+ * game, but it makes a lot of them
+ ***************************************/
+Game :: ~Game()
+{
+   // the bots' pilots are ours, the screen player's is the caller's
+   for (size_t i = 0; i < players.size(); i++)
+   {
+      delete players[i].pShip;
+      if (players[i].isBot)
+         delete players[i].pPilot;
+   }
+   for (list<Bullet*>::iterator it = bullets.begin(); it != bullets.end(); it++)
+      delete *it;
+   for (list<Bullet*>::iterator it = debris.begin(); it != debris.end(); it++)
+      delete *it;
+   for (list<Bullet*>::iterator it = stars.begin(); it != stars.end(); it++)
+      delete *it;
+   for (list<Rocks*>::iterator it = rocks.begin(); it != rocks.end(); it++)
+      delete *it;
+}
+
 /***************************************
  * GAME :: ADVANCE
  * advance the game one unit of time
  ***************************************/
 void Game :: advance()
 {
-   pShip->advance();
-   for (list<Bullet*>::iterator starIt = stars.begin();
-        starIt != stars.end();
-        starIt++)
-   {
-      (*starIt)->advance();
-   }
-   for (list<Bullet*>::iterator debrisIt = debris.begin();
-        debrisIt != debris.end();
-        debrisIt++)
+   TRACE_SCOPE("Game::advance");
+   long long start = monotonicNow();
+   PerfCounters::begin(PERF_PHASE_ADVANCE);
+   for (size_t i = 0; i < players.size(); i++)
+      players[i].pShip->advance(!resimulating);
+   if (!resimulating)
    {
-      (*debrisIt)->advance();
+      for (list<Bullet*>::iterator starIt = stars.begin();
+           starIt != stars.end();
+           starIt++)
+      {
+         (*starIt)->advance();
+      }
+      for (list<Bullet*>::iterator debrisIt = debris.begin();
+           debrisIt != debris.end();
+           debrisIt++)
+      {
+         (*debrisIt)->advance();
+      }
    }
    for (list<Bullet*>::iterator bulletIt = bullets.begin();
         bulletIt != bullets.end();
@@ -79,9 +129,448 @@ void Game :: advance()
    {
       (*rockIt)->advance();
    }
+   PerfCounters::end(PERF_PHASE_ADVANCE, countEntities());
+
+   PerfCounters::begin(PERF_PHASE_COLLISIONS);
    checkForCollisions();
+   PerfCounters::end(PERF_PHASE_COLLISIONS, rocks.size() + bullets.size());
+
+   PerfCounters::begin(PERF_PHASE_CLEANUP);
    cleanUpZombies();
-   
+   buildIndex();
+   PerfCounters::end(PERF_PHASE_CLEANUP, countEntities());
+   tickTime = monotonicNow() - start;
+}
+
+/***************************************
+ * HASH MIX
+ * One step of 64-bit FNV-1a over the bytes
+ * of a value
+ ***************************************/
+template <class T>
+static void hashMix(unsigned long long & hash, const T & value)
+{
+   unsigned char bytes[sizeof(T)];
+   memcpy(bytes, &value, sizeof(T));
+   for (size_t i = 0; i < sizeof(T); i++)
+   {
+      hash ^= bytes[i];
+      hash *= 1099511628211ULL;
+   }
+}
+
+/***************************************
+ * GAME :: GETSTATEHASH
+ * A fingerprint of everything that decides
+ * how the game plays out: the ships, every
+ * rock, every bullet and the scores.  Eye
+ * candy like debris and stars is left out.
+ * Two runs that hash the same played the
+ * same.  The bots come last, so a game with
+ * none hashes the way it always has.
+ ***************************************/
+static void hashShip(unsigned long long & hash, const Ship & ship)
+{
+   hashMix(hash, ship.isAlive());
+   hashMix(hash, ship.getPosition().getX());
+   hashMix(hash, ship.getPosition().getY());
+   hashMix(hash, ship.getVelocity().getDx());
+   hashMix(hash, ship.getVelocity().getDy());
+   hashMix(hash, ship.getRotation());
+}
+
+unsigned long long Game :: getStateHash() const
+{
+   unsigned long long hash = 14695981039346656037ULL;
+   hashMix(hash, players[0].score);
+   hashShip(hash, *players[0].pShip);
+
+   for (list<Rocks*>::const_iterator rockIt = rocks.begin();
+        rockIt != rocks.end();
+        rockIt++)
+   {
+      hashMix(hash, (*rockIt)->getTier());
+      hashMix(hash, (*rockIt)->isAlive());
+      hashMix(hash, (*rockIt)->getPosition().getX());
+      hashMix(hash, (*rockIt)->getPosition().getY());
+      hashMix(hash, (*rockIt)->getAngle());
+      hashMix(hash, (*rockIt)->getRotation());
+   }
+
+   for (list<Bullet*>::const_iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end();
+        bulletIt++)
+   {
+      hashMix(hash, (*bulletIt)->getPosition().getX());
+      hashMix(hash, (*bulletIt)->getPosition().getY());
+      hashMix(hash, (*bulletIt)->getLives());
+   }
+
+   for (size_t i = 1; i < players.size(); i++)
+   {
+      hashMix(hash, players[i].score);
+      hashShip(hash, *players[i].pShip);
+   }
+   return hash;
+}
+
+/***************************************
+ * GAME :: SAVESTATE
+ * Flatten the simulation into plain arrays
+ ***************************************/
+void Game :: saveState(GameState & state) const
+{
+   state.ships.resize(players.size());
+   for (size_t i = 0; i < players.size(); i++)
+   {
+      const Ship & ship = *players[i].pShip;
+      ShipState & saved = state.ships[i];
+      saved.x        = ship.getPosition().getX();
+      saved.y        = ship.getPosition().getY();
+      saved.dx       = ship.getVelocity().getDx();
+      saved.dy       = ship.getVelocity().getDy();
+      saved.rotation = ship.getRotation();
+      saved.lives    = ship.getLives();
+      saved.weapon   = ship.getWeapon();
+      saved.score    = players[i].score;
+      saved.pilotDeadTicks = players[i].isBot ? players[i].pPilot->getDeadTicks() : 0;
+      saved.pilotCoolDown  = players[i].isBot ? players[i].pPilot->getCoolDown()  : 0;
+   }
+
+   state.rocks.clear();
+   for (list<Rocks*>::const_iterator rockIt = rocks.begin();
+        rockIt != rocks.end();
+        rockIt++)
+   {
+      const Rocks & rock = **rockIt;
+      RockState saved = RockState();   // zeroes every byte
+      saved.x         = rock.getPosition().getX();
+      saved.y         = rock.getPosition().getY();
+      saved.dx        = rock.getVelocity().getDx();
+      saved.dy        = rock.getVelocity().getDy();
+      saved.rotation  = rock.getRotation();
+      saved.angle     = rock.getAngle();
+      saved.lives     = rock.getLives();
+      saved.tier      = (unsigned char)rock.getTier();
+      saved.direction = rock.getDirection();
+      saved.collision = rock.isCollision();
+      saved.id        = rock.getId();
+      state.rocks.push_back(saved);
+   }
+
+   state.bullets.clear();
+   for (list<Bullet*>::const_iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end();
+        bulletIt++)
+   {
+      const Bullet & bullet = **bulletIt;
+      BulletState saved = BulletState();
+      saved.x        = bullet.getPosition().getX();
+      saved.y        = bullet.getPosition().getY();
+      saved.dx       = bullet.getVelocity().getDx();
+      saved.dy       = bullet.getVelocity().getDy();
+      saved.speed    = bullet.getSpeed();
+      saved.rotation = bullet.getRotation();
+      saved.lives    = bullet.getLives();
+      saved.size     = bullet.getSize();
+      saved.distance = bullet.getDistance();
+      saved.owner    = (short)bullet.getOwner();
+      saved.type     = (char)bullet.getType();
+      saved.weapon   = (char)bullet.getWeapon();
+      saved.id       = bullet.getId();
+      state.bullets.push_back(saved);
+   }
+
+   state.random = SimRandom::getState();
+   state.nextId = FlyingObject::getNextId();
+}
+
+/***************************************
+ * GAME :: CAPTURESNAPSHOT
+ * The ships, rocks and bullets, the way a
+ * client sees them.  Stars, debris and the
+ * trails stay here
+ ***************************************/
+void Game :: captureSnapshot(Snapshot & snapshot, int tick) const
+{
+   snapshot.tick = tick;
+   snapshot.entities.clear();
+   for (size_t i = 0; i < players.size(); i++)
+   {
+      const Ship & ship = *players[i].pShip;
+      EntityState e;
+      e.id       = ship.getId();
+      e.kind     = ENTITY_SHIP;
+      e.detail   = (ship.isAlive() ? ENTITY_ALIVE : 0) |
+                   (ship.isThrusting() ? ENTITY_THRUSTING : 0);
+      e.owner    = (unsigned char)i;
+      e.rotation = quantiseRotation(ship.getRotation());
+      e.x        = quantise(ship.getPosition().getX());
+      e.y        = quantise(ship.getPosition().getY());
+      snapshot.entities.push_back(e);
+   }
+
+   for (list<Rocks*>::const_iterator rockIt = rocks.begin();
+        rockIt != rocks.end();
+        rockIt++)
+   {
+      const Rocks & rock = **rockIt;
+      EntityState e;
+      e.id       = rock.getId();
+      e.kind     = ENTITY_ROCK;
+      e.detail   = (unsigned char)rock.getTier();
+      e.owner    = 0;
+      e.rotation = quantiseRotation(rock.getRotation());
+      e.x        = quantise(rock.getPosition().getX());
+      e.y        = quantise(rock.getPosition().getY());
+      snapshot.entities.push_back(e);
+   }
+
+   for (list<Bullet*>::const_iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end();
+        bulletIt++)
+   {
+      const Bullet & bullet = **bulletIt;
+      EntityState e;
+      e.id       = bullet.getId();
+      e.kind     = ENTITY_BULLET;
+      e.detail   = (unsigned char)bullet.getWeapon();
+      e.owner    = (unsigned char)bullet.getOwner();
+      e.rotation = quantiseRotation(bullet.getRotation());
+      e.x        = quantise(bullet.getPosition().getX());
+      e.y        = quantise(bullet.getPosition().getY());
+      snapshot.entities.push_back(e);
+   }
+
+   sort(snapshot.entities.begin(), snapshot.entities.end(),
+        [](const EntityState & lhs, const EntityState & rhs)
+        { return lhs.id < rhs.id; });
+}
+
+/***************************************
+ * BROADCAST ENTITY
+ * Fill in one for the spectators
+ ***************************************/
+static inline void setEntity(BroadcastEntity & e, int kind, int detail,
+                             const FlyingObject & object, int owner,
+                             unsigned char red, unsigned char green,
+                             unsigned char blue)
+{
+   int rotation = object.getRotation() % 360;
+   e.x        = object.getPosition().getX();
+   e.y        = object.getPosition().getY();
+   e.rotation = (unsigned short)(rotation < 0 ? rotation + 360 : rotation);
+   e.kind     = (unsigned char)kind;
+   e.detail   = (unsigned char)detail;
+   e.red      = red;
+   e.green    = green;
+   e.blue     = blue;
+   e.owner    = (unsigned char)owner;
+}
+
+/***************************************
+ * GAME :: BROADCAST
+ * Straight into the shared ring, in the
+ * colours they are drawn.  Debris goes last,
+ * so it is what is left off when the frame
+ * is full
+ ***************************************/
+void Game :: broadcast() const
+{
+   BroadcastEntity * pOut = Broadcast::beginFrame(EventBus::getFrame());
+   int count = 0;
+   for (size_t i = 0; i < players.size() && count < BROADCAST_ENTITIES; i++)
+   {
+      const Ship & ship = *players[i].pShip;
+      setEntity(pOut[count++], BROADCAST_SHIP,
+                (ship.isAlive() ? BROADCAST_ALIVE : 0) |
+                (ship.isThrusting() ? BROADCAST_THRUSTING : 0),
+                ship, (int)i, 255, 255, 255);
+   }
+   for (list<Rocks*>::const_iterator rockIt = rocks.begin();
+        rockIt != rocks.end() && count < BROADCAST_ENTITIES;
+        rockIt++)
+      setEntity(pOut[count++], BROADCAST_ROCK, (*rockIt)->getTier(),
+                **rockIt, 0, 255, 255, 255);
+   for (list<Bullet*>::const_iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end() && count < BROADCAST_ENTITIES;
+        bulletIt++)
+      setEntity(pOut[count++], BROADCAST_BULLET, (*bulletIt)->getWeapon(),
+                **bulletIt, (*bulletIt)->getOwner(), 255, 255, 255);
+   for (list<Bullet*>::const_iterator debrisIt = debris.begin();
+        debrisIt != debris.end() && count < BROADCAST_ENTITIES;
+        debrisIt++)
+   {
+      // the middle of the colours they flicker between
+      if ((*debrisIt)->getType() == 3)
+         setEntity(pOut[count++], BROADCAST_DEBRIS, 3, **debrisIt, 0,
+                   0, 0, 140);
+      else
+         setEntity(pOut[count++], BROADCAST_DEBRIS, 1, **debrisIt, 0,
+                   166, 115, 0);
+   }
+   Broadcast::endFrame(count);
+}
+
+/***************************************
+ * GAME :: LOADSTATE
+ * Put a saved simulation back.  The rocks
+ * and bullets we have are reused, so only
+ * the difference in count is allocated or
+ * freed.
+ ***************************************/
+void Game :: loadState(const GameState & state)
+{
+   assert(state.ships.size() == players.size());
+   for (size_t i = 0; i < players.size(); i++)
+   {
+      Ship & ship = *players[i].pShip;
+      const ShipState & saved = state.ships[i];
+      ship.setPosition(Point(saved.x, saved.y));
+      ship.setVelocity(Velocity(Point(saved.dx, saved.dy)));
+      ship.setRotation(saved.rotation);
+      ship.setLives(saved.lives);
+      ship.setWeapon(saved.weapon);
+      players[i].score = saved.score;
+      if (players[i].isBot)
+         players[i].pPilot->restore(saved.pilotDeadTicks, saved.pilotCoolDown);
+   }
+
+   list<Rocks*>::iterator rockIt = rocks.begin();
+   for (size_t i = 0; i < state.rocks.size(); i++, rockIt++)
+   {
+      if (rockIt == rocks.end())
+         rockIt = rocks.insert(rockIt, new Rocks);
+      Rocks & rock = **rockIt;
+      const RockState & saved = state.rocks[i];
+      rock.setTier(saved.tier);
+      rock.setPosition(Point(saved.x, saved.y));
+      rock.setVelocity(Velocity(Point(saved.dx, saved.dy)));
+      rock.setRotation(saved.rotation);
+      rock.setAngle(saved.angle);
+      rock.setLives(saved.lives);
+      rock.setDirection(saved.direction != 0);
+      rock.setCollision(saved.collision != 0);
+      rock.setId(saved.id);
+   }
+   while (rockIt != rocks.end())
+   {
+      delete *rockIt;
+      rockIt = rocks.erase(rockIt);
+   }
+
+   list<Bullet*>::iterator bulletIt = bullets.begin();
+   for (size_t i = 0; i < state.bullets.size(); i++, bulletIt++)
+   {
+      if (bulletIt == bullets.end())
+         bulletIt = bullets.insert(bulletIt, new Bullet);
+      Bullet & bullet = **bulletIt;
+      const BulletState & saved = state.bullets[i];
+      bullet.setPosition(Point(saved.x, saved.y));
+      bullet.setVelocity(Velocity(Point(saved.dx, saved.dy)));
+      bullet.setSpeed(saved.speed);
+      bullet.setRotation(saved.rotation);
+      bullet.setLives(saved.lives);
+      bullet.setSize(saved.size);
+      bullet.setDistance(saved.distance);
+      bullet.setOwner(saved.owner);
+      bullet.setType(saved.type);
+      bullet.setWeapon(saved.weapon);
+      bullet.setId(saved.id);
+   }
+   while (bulletIt != bullets.end())
+   {
+      delete *bulletIt;
+      bulletIt = bullets.erase(bulletIt);
+   }
+
+   // last, since making a rock draws from it and takes an id
+   SimRandom::setState(state.random);
+   FlyingObject::setNextId(state.nextId);
+
+   // the rocks are what the simulation looks up.  The dots are only
+   // drawn, so they wait until then: a rollback plays on before it
+   // draws, and its next tick sorts them anyway
+   indexRocks();
+   dotsIndexed = false;
+}
+
+/***************************************
+ * GAME :: SETRESIMULATING
+ ***************************************/
+void Game :: setResimulating(bool resimulating)
+{
+   this->resimulating = resimulating;
+   EventBus::setMuted(resimulating);
+}
+
+/***************************************
+ * GAME :: COUNTENTITIES
+ * Everything that moves, trail included
+ ***************************************/
+int Game :: countEntities() const
+{
+   return countShips() + (int)stars.size() +
+          (int)debris.size() + (int)bullets.size() + (int)rocks.size();
+}
+
+/***************************************
+ * GAME :: COUNTSHIPS
+ * Every ship and every dot of its trail
+ ***************************************/
+int Game :: countShips() const
+{
+   int count = 0;
+   for (size_t i = 0; i < players.size(); i++)
+      count += 1 + players[i].pShip->getTrailCount();
+   return count;
+}
+
+/***************************************
+ * GAME :: BUILDINDEX
+ * Sort everything into the spatial grids
+ * so we can find it by position.
+ ***************************************/
+void Game :: buildIndex()
+{
+   indexRocks();
+   indexDots();
+}
+
+/***************************************
+ * GAME :: INDEXROCKS
+ ***************************************/
+void Game :: indexRocks()
+{
+   for (list<Rocks*>::iterator rockIt = rocks.begin();
+        rockIt != rocks.end();
+        rockIt++)
+      rockGrid.add(*rockIt, (*rockIt)->getPosition());
+   rockGrid.build();
+}
+
+/***************************************
+ * GAME :: INDEXDOTS
+ * The stars, and the debris and bullets
+ ***************************************/
+void Game :: indexDots()
+{
+   for (list<Bullet*>::iterator starIt = stars.begin();
+        starIt != stars.end();
+        starIt++)
+      starGrid.add(*starIt, (*starIt)->getPosition());
+   starGrid.build();
+
+   for (list<Bullet*>::iterator debrisIt = debris.begin();
+        debrisIt != debris.end();
+        debrisIt++)
+      dotGrid.add(*debrisIt, (*debrisIt)->getPosition());
+   for (list<Bullet*>::iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end();
+        bulletIt++)
+      dotGrid.add(*bulletIt, (*bulletIt)->getPosition());
+   dotGrid.build();
+   dotsIndexed = true;
 }
 
 /***************************************
@@ -90,37 +579,145 @@ void Game :: advance()
  ***************************************/
 void Game :: handleInput(const Interface & ui)
 {
+   handleInput(readInput(ui));
+}
+
+/***************************************
+ * GAME :: READINPUT
+ * the keys the player on the screen is
+ * holding, or what its autopilot would hold
+ ***************************************/
+int Game :: readInput(const Interface & ui)
+{
+   if (players[viewer].pPilot)
+      return players[viewer].pPilot->decide(*this, viewer);
+   return readKeys(ui);
+}
+
+/***************************************
+ * GAME :: READKEYS
+ * the keys held on the keyboard
+ ***************************************/
+int Game :: readKeys(const Interface & ui)
+{
+   int keys = 0;
+   if (ui.isLeft())
+      keys |= INPUT_LEFT;
+   if (ui.isRight())
+      keys |= INPUT_RIGHT;
+   if (ui.isUp())
+      keys |= INPUT_UP;
+   if (ui.isDown())
+      keys |= INPUT_DOWN;
+   if (ui.isSpace())
+      keys |= INPUT_SPACE;
+   if (ui.isR())
+      keys |= INPUT_R;
+   return keys;
+}
+
+/***************************************
+ * GAME :: input
+ * act on the keys held this tick, whether
+ * they came from the keyboard or a script,
+ * then let every bot make its move
+ ***************************************/
+void Game :: handleInput(int keys)
+{
+   handleInput(&keys, 1);
+}
+
+/***************************************
+ * GAME :: input
+ * act on the keys for the first count
+ * players, then let every bot make its move.
+ * A bot flies itself even if it is among the
+ * first count
+ ***************************************/
+void Game :: handleInput(const int keys[], int count)
+{
+   ALLOC_SCOPE("Game::handleInput");
+   for (int i = 0; i < (int)players.size(); i++)
+   {
+      if (players[i].isBot)
+         applyInput(i, players[i].pPilot->decide(*this, i));
+      else if (i < count)
+         applyInput(i, keys[i]);
+      else
+         applyInput(i, 0);
+   }
+}
+
+/***************************************
+ * GAME :: ADDBOTS
+ * More ships, each with its own autopilot,
+ * dropped at random spots in the world
+ ***************************************/
+void Game :: addBots(int count, int difficulty, int aggression)
+{
+   for (int i = 0; i < count; i++)
+   {
+      Player bot = { new Ship, new Autopilot(difficulty, aggression), true,
+                     World::getSpawnPoint(), 0 };
+      bot.pShip->setOwner((int)players.size());
+      bot.pShip->setPosition(bot.spawn);
+      players.push_back(bot);
+   }
+}
+
+/***************************************
+ * GAME :: ADDPLAYER
+ * A ship nobody here is flying: its keys
+ * are handed to handleInput()
+ ***************************************/
+void Game :: addPlayer(const Point & spawn)
+{
+   Player player = { new Ship, NULL, false, spawn, 0 };
+   player.pShip->setOwner((int)players.size());
+   player.pShip->setPosition(spawn);
+   players.push_back(player);
+}
+
+/***************************************
+ * GAME :: APPLYINPUT
+ * One player's keys for this tick
+ ***************************************/
+void Game :: applyInput(int player, int keys)
+{
+   Ship * pShip = players[player].pShip;
+   pShip->setThrusting(false);
    if (pShip->isAlive())
    {
-      if (ui.isLeft())
+      if (keys & INPUT_LEFT)
       {
          pShip->turnLeft();
       }
       
-      if (ui.isRight())
+      if (keys & INPUT_RIGHT)
       {
          pShip->turnRight();
       }
       
-      if (ui.isUp())
+      if (keys & INPUT_UP)
       {
          pShip->thrust();
       }
       
-      if (ui.isSpace())
+      if (keys & INPUT_SPACE)
       {
          Bullet* pBullet = new Bullet(*pShip);
          bullets.push_back(pBullet);
       }
-      if (ui.isR())
+      if (keys & INPUT_R)
          pShip->setWeapon(pShip->getWeapon() + 1);
    }
-   if (ui.isDown())
+   if (keys & INPUT_DOWN)
       if (!pShip->isAlive())
       {
-         pShip->setPosition(Point(0, 0));
+         pShip->setPosition(players[player].spawn);
          pShip->setVelocity(Velocity(Point(0, 0)));
          pShip->setLives(1);
+         EventBus::publish(EVENT_SHIP_RESPAWN, pShip->getPosition());
       }
 }
 
@@ -130,78 +727,239 @@ void Game :: handleInput(const Interface & ui)
  *********************************************/
 void Game :: draw(const Interface & ui)
 {
-   pShip->draw(ui);
+   ALLOC_SCOPE("Game::draw");
+   TRACE_SCOPE("Game::draw");
+   PerfCounters::begin(PERF_PHASE_DRAW);
+   stateChanges = getStateChanges();
+   resetStateChanges();
+   camera.follow(players[viewer].pShip->getPosition());
+   camera.applyWorld();
 
-   //stars on screen
-   for (list<Bullet*>::iterator starIt = stars.begin();
-        starIt != stars.end();
-        starIt++)
-   {
-      (*starIt)->draw();
-   }
+   // rocks get simpler as they shrink on the screen, and all the eye
+   // candy gets turned down when the frames run long
+   LevelOfDetail::setScale(camera.getScale());
+   QualityGovernor::update(ui.getLastWorkTime(),
+                           (long long)(ui.frameRate() * 1000000000.0));
 
-   //explosion on screen
-   for (list<Bullet*>::iterator debrisIt = debris.begin();
-        debrisIt != debris.end();
-        debrisIt++)
+   // only what the grids say is near the view gets drawn
+   const Camera & view = camera;
+   drawn = 0;
+   for (size_t i = 0; i < players.size(); i++)
+      if ((int)i == viewer || view.isVisible(players[i].pShip->getPosition(), CULL_MARGIN))
+      {
+         players[i].pShip->draw();
+         drawn++;
+      }
+   int & count = drawn;
+   int starsSeen = 0;
+   auto drawVisibleStar = [&view, &count, &starsSeen](Bullet * pStar)
    {
-      (*debrisIt)->draw();
-   }
-   
-   for (list<Bullet*>::iterator bulletIt = bullets.begin();
-        bulletIt != bullets.end();
-        bulletIt++)
+      if (view.isVisible(pStar->getPosition(), CULL_MARGIN) &&
+          QualityGovernor::isStarDrawn(starsSeen++))
+      {
+         pStar->draw();
+         count++;
+      }
+   };
+   auto drawVisibleDot = [&view, &count](Bullet * pDot)
    {
-      (*bulletIt)->draw();
-   }
-   
-   for (list<Rocks*>::iterator rockIt = rocks.begin();
-        rockIt != rocks.end();
-        rockIt++)
+      if (view.isVisible(pDot->getPosition(), CULL_MARGIN))
+      {
+         pDot->draw();
+         count++;
+      }
+   };
+   auto drawVisibleRock = [&view, &count](Rocks * pRock)
    {
-      (*rockIt)->draw();
-   }
+      if (view.isVisible(pRock->getPosition(), CULL_MARGIN))
+      {
+         pRock->draw();
+         count++;
+      }
+   };
+   float left   = camera.getXMin() - CULL_MARGIN;
+   float bottom = camera.getYMin() - CULL_MARGIN;
+   float right  = camera.getXMax() + CULL_MARGIN;
+   float top    = camera.getYMax() + CULL_MARGIN;
+   if (!dotsIndexed)
+      indexDots();
+   starGrid.query(left, bottom, right, top, drawVisibleStar);
+   dotGrid.query(left, bottom, right, top, drawVisibleDot);
+   rockGrid.query(left, bottom, right, top, drawVisibleRock);
+   flushMeshes();
+   flushBatches();
+   PerfCounters::end(PERF_PHASE_DRAW, drawn);
+
+   // the messages and the HUD stay put on the screen
+   camera.applyScreen();
    if (rocks.size() == 0)
    {
       drawFunny(Point(10, 50), 180);
-      drawText(Point(-60, -50), "Thanks for playing :)");
-      drawText(Point(-70, -70), "Stay classy Ercanbrack!");
-      Rocks rock;
-      rock.setPosition(Point(-5, 10));
-      rock.setSize(2);
-      createDebris(rock.getPosition(), rock.getSize(), 1);
+      drawStaticText(Point(-60, -50), "Thanks for playing :)");
+      drawStaticText(Point(-70, -70), "Stay classy Ercanbrack!");
+      createDebris(Point(-5, 10), 2, 1);
    }
    else
    {
       //displays a message on the screen if there are any asteroids alive
-      drawText(Point(-98, -170), "Shoot all the asteroids for the suprise!");
-      drawText(Point(-150, -185), "Down arrow key to respawn and r key to switch weapon.");
+      drawStaticText(Point(-98, -170), "Shoot all the asteroids for the suprise!");
+      drawStaticText(Point(-150, -185), "Down arrow key to respawn and r key to switch weapon.");
    }
+
+   drawOverlay(ui);
 }
 
 /*********************************************
- * GAME :: checkForCollisions
- * Check for collisions between any two objects.
+ * GAME :: DRAWOVERLAY
+ * The score, and if asked for, the frame rate and
+ * how many of each thing are flying around.  The
+ * labels are cached text and the numbers do not
+ * allocate, so this costs the same every frame.
  *********************************************/
-void Game::checkForCollisions()
+void Game :: drawOverlay(const Interface & ui)
 {
-   // go through each rock
-   for (list<Rocks*>::iterator rockIt = rocks.begin();
-        rockIt != rocks.end();
-        rockIt++)
+   drawNumber(Point(camera.getScreenXMin() + 10,
+                    camera.getScreenYMax() - 10), players[viewer].score);
+
+   if (!showStats)
+      return;
+
+   long long frameTime = ui.getRecentFrameTime();
+   int fps = frameTime > 0 ? (int)(1000000000LL / frameTime) : 0;
+
+   float x = camera.getScreenXMax() - 110;
+   float y = camera.getScreenYMax() - 20;
+   drawStaticText(Point(x, y      ), "FPS");
+   drawStaticText(Point(x, y - 15 ), "ROCKS");
+   drawStaticText(Point(x, y - 30 ), "BULLETS");
+   drawStaticText(Point(x, y - 45 ), "DEBRIS");
+   drawStaticText(Point(x, y - 75 ), "DRAWN");
+   drawNumber(Point(x + 60, y + 10     ), fps);
+   drawNumber(Point(x + 60, y + 10 - 15), (int)rocks.size());
+   drawNumber(Point(x + 60, y + 10 - 30), (int)bullets.size());
+   drawNumber(Point(x + 60, y + 10 - 45), (int)debris.size());
+   drawNumber(Point(x + 60, y + 10 - 75), drawn);
+   drawStaticText(Point(x, y - 90 ), "DETAIL");
+   drawNumber(Point(x + 60, y + 10 - 90), LevelOfDetail::getBias());
+   drawStaticText(Point(x, y - 105), "QUALITY");
+   drawNumber(Point(x + 60, y + 10 - 105), QualityGovernor::getLevel());
+   drawStaticText(Point(x, y - 120), "STATE");
+   drawNumber(Point(x + 60, y + 10 - 120), stateChanges);
+
+   // microseconds from a key going down to the tick that saw it and
+   // to the frame that showed it
+   const FrameHistogram & toSimulation = Interface::getInputToSimulation();
+   const FrameHistogram & toPhoton     = Interface::getInputToPhoton();
+   drawStaticText(Point(x, y - 195), "SIM P50");
+   drawNumber(Point(x + 60, y + 10 - 195), (int)(toSimulation.getP50() / 1000));
+   drawStaticText(Point(x, y - 210), "SIM P99");
+   drawNumber(Point(x + 60, y + 10 - 210), (int)(toSimulation.getP99() / 1000));
+   drawStaticText(Point(x, y - 225), "PIX P50");
+   drawNumber(Point(x + 60, y + 10 - 225), (int)(toPhoton.getP50() / 1000));
+   drawStaticText(Point(x, y - 240), "PIX P99");
+   drawNumber(Point(x + 60, y + 10 - 240), (int)(toPhoton.getP99() / 1000));
+
+   // a dropped frame is a hole in the recording
+   if (FrameCapture::isActive())
+   {
+      if (FrameCapture::getDropped() > 0)
+         changeColor(1.0, 0.0, 0.0);
+      drawStaticText(Point(x, y - 135), "DROPPED");
+      drawNumber(Point(x + 60, y + 10 - 135),
+                 (int)FrameCapture::getDropped());
+      changeColor(1.0, 1.0, 1.0);
+   }
+
+   // instructions per cycle as a percentage, and L1 misses per
+   // entity, when the hardware will tell us
+   if (PerfCounters::isAvailable())
+   {
+      const PerfSample & advance    = PerfCounters::getLast(PERF_PHASE_ADVANCE);
+      const PerfSample & collisions = PerfCounters::getLast(PERF_PHASE_COLLISIONS);
+      drawStaticText(Point(x, y - 150), "ADV IPC%");
+      drawNumber(Point(x + 60, y + 10 - 150),
+                 (int)(PerfCounters::getIpc(advance) * 100.0));
+      drawStaticText(Point(x, y - 165), "COL IPC%");
+      drawNumber(Point(x + 60, y + 10 - 165),
+                 (int)(PerfCounters::getIpc(collisions) * 100.0));
+      drawStaticText(Point(x, y - 180), "L1 MISS/E");
+      drawNumber(Point(x + 60, y + 10 - 180),
+                 (int)PerfCounters::getPerEntity(advance, PERF_L1D_MISSES));
+   }
+
+   // allocations are only counted when the tracker is built in
+   if (AllocTracker::isEnabled())
+   {
+      if (AllocTracker::isOverBudget())
+         changeColor(1.0, 0.0, 0.0);
+      drawStaticText(Point(x, y - 60), "ALLOCS");
+      drawNumber(Point(x + 60, y + 10 - 60),
+                 (int)AllocTracker::getFrame().allocations);
+      changeColor(1.0, 1.0, 1.0);
+   }
+}
+
+/*********************************************
+ * GAME :: UPDATEMETRICS
+ * Hand this frame's numbers to whoever is
+ * scraping them
+ *********************************************/
+void Game :: updateMetrics(long long frameTime, long long workTime)
+{
+   Metrics::set(METRIC_FRAME_TIME,      frameTime);
+   Metrics::set(METRIC_WORK_TIME,       workTime);
+   Metrics::set(METRIC_FRAMES,          EventBus::getFrame());
+   Metrics::set(METRIC_ROCKS,           rocks.size());
+   Metrics::set(METRIC_BULLETS,         bullets.size());
+   Metrics::set(METRIC_DEBRIS,          debris.size());
+   Metrics::set(METRIC_STARS,           stars.size());
+   Metrics::set(METRIC_TRAIL,           countShips() - (int)players.size());
+   Metrics::set(METRIC_ALLOCATIONS,     AllocTracker::getFrame().allocations);
+   Metrics::set(METRIC_COLLISION_TESTS, collisionTests);
+   Metrics::set(METRIC_COLLISION_HITS,  collisionHits);
+   Metrics::set(METRIC_QUALITY,         QualityGovernor::getLevel());
+   Metrics::set(METRIC_SCORE,           players[viewer].score);
+   Metrics::set(METRIC_TICK_TIME,       tickTime);
+   Metrics::set(METRIC_INPUT_SIM_P50,   Interface::getInputToSimulation().getP50());
+   Metrics::set(METRIC_INPUT_SIM_P99,   Interface::getInputToSimulation().getP99());
+   Metrics::set(METRIC_INPUT_PHOTON_P50, Interface::getInputToPhoton().getP50());
+   Metrics::set(METRIC_INPUT_PHOTON_P99, Interface::getInputToPhoton().getP99());
+}
+
+/*********************************************
+ * GAME :: checkForCollisions
+ * Check for collisions between any two objects.
+ * The ships and bullets go in grids first, so
+ * each rock only tests the ones near it.  What
+ * a grid finds is tested in list order, so the
+ * hits come out just as if we had tested them
+ * all.
+ *********************************************/
+void Game::checkForCollisions()
+{
+   TRACE_SCOPE("Game::checkForCollisions");
+   collisionTests = 0;
+   collisionHits  = 0;
+   float shipReach   = indexShips();
+   float bulletReach = indexBullets();
+
+   // go through each rock
+   for (list<Rocks*>::iterator rockIt = rocks.begin();
+        rockIt != rocks.end();
+        rockIt++)
    {
       int collisionCount = 0;
       for (list<Rocks*>::iterator rockIt2 = rocks.begin(); rockIt2 != rocks.end(); rockIt2++)
       {
          if (rockIt2 != rockIt)
          {
-            if (isCollision(**rockIt2, **rockIt))
+            if (testCollision(**rockIt2, **rockIt))
             {
                if ((*rockIt)->isCollision())
                {
                   (*rockIt)->setCollision(false);
                   (*rockIt)->setAngle((*rockIt)->getAngle() + 180);
-                  (*rockIt2)->setAngle((*rockIt2)->getAngle() + random(-45, 45));
+                  (*rockIt2)->setAngle((*rockIt2)->getAngle() + SimRandom::next(-45, 45));
                }
                if (!(*rockIt)->isCollision())
                   collisionCount++;
@@ -211,31 +969,153 @@ void Game::checkForCollisions()
       if (!(*rockIt)->isCollision())
          if (collisionCount == 0)
             (*rockIt)->setCollision(true);
-      // check for collision with the ship
-      if (isCollision(*pShip, **rockIt))
+
+      // check for collision with the ships near it
+      findNearby(shipGrid, **rockIt, shipReach);
+      for (size_t i = 0; i < nearby.size(); i++)
       {
-         pShip->kill();
-         createDebris(pShip->getPosition(), pShip->getSize(), 3);
-         (*rockIt)->kill();
-         (*rockIt)->breakApart(rocks);
-         createDebris((**rockIt).getPosition(), (**rockIt).getSize(), 1);
+         Ship * pShip = players[nearby[i]].pShip;
+         if (testCollision(*pShip, **rockIt))
+         {
+            EventBus::publish(EVENT_SHIP_KILLED, pShip->getPosition());
+            EventBus::publish(EVENT_ROCK_DESTROYED, (*rockIt)->getPosition(),
+                              (*rockIt)->getTier());
+            pShip->kill();
+            createDebris(pShip->getPosition(), pShip->getSize(), 3);
+            (*rockIt)->kill();
+            ALLOC_SCOPE("Rocks::breakApart");
+            (*rockIt)->breakApart(rocks);
+            createDebris((**rockIt).getPosition(), (**rockIt).getSize(), 1);
+         }
       }
       
-      // go through each bullet
-      for (list<Bullet*>::iterator bulletIt = bullets.begin();
-           bulletIt != bullets.end();
-           bulletIt++)
+      // go through each bullet near it
+      findNearby(bulletGrid, **rockIt, bulletReach);
+      for (size_t i = 0; i < nearby.size(); i++)
       {
+         Bullet * pBullet = bulletArray[nearby[i]];
+
          // check for collision between this rock and this bullet
-         if (isCollision(**bulletIt, **rockIt))
+         if (testCollision(*pBullet, **rockIt))
          {
-            (*bulletIt)->kill();
+            EventBus::publish(EVENT_BULLET_HIT, pBullet->getPosition(),
+                              (*rockIt)->getTier());
+            if ((*rockIt)->isAlive())
+            {
+               if (pBullet->getOwner() >= 0)
+                  players[pBullet->getOwner()].score += (*rockIt)->getPoints();
+               EventBus::publish(EVENT_ROCK_DESTROYED, (*rockIt)->getPosition(),
+                                 (*rockIt)->getTier(), (*rockIt)->getPoints());
+            }
+            pBullet->kill();
             (*rockIt)->kill();
+            ALLOC_SCOPE("Rocks::breakApart");
             (*rockIt)->breakApart(rocks);
             createDebris((**rockIt).getPosition(), (**rockIt).getSize(), 1);
          }
       }
    }
+
+   // with more than one ship, bullets hit the ships that did not
+   // fire them
+   if (players.size() < 2)
+      return;
+   for (size_t i = 0; i < bulletArray.size(); i++)
+   {
+      Bullet * pBullet = bulletArray[i];
+      findNearby(shipGrid, *pBullet, shipReach);
+      for (size_t j = 0; j < nearby.size(); j++)
+      {
+         if (nearby[j] == pBullet->getOwner())
+            continue;
+         Ship * pShip = players[nearby[j]].pShip;
+         if (testCollision(*pBullet, *pShip))
+         {
+            EventBus::publish(EVENT_SHIP_KILLED, pShip->getPosition());
+            pBullet->kill();
+            pShip->kill();
+            createDebris(pShip->getPosition(), pShip->getSize(), 3);
+         }
+      }
+   }
+}
+
+/*********************************************
+ * GAME :: INDEXSHIPS
+ * Drop every ship into the ship grid.  Returns
+ * how far past its position any ship can reach
+ * this tick: its size plus how far it moves.
+ *********************************************/
+float Game::indexShips()
+{
+   float reach = 0.0;
+   for (size_t i = 0; i < players.size(); i++)
+   {
+      const Ship & ship = *players[i].pShip;
+      shipGrid.add((int)i, ship.getPosition());
+      reach = max(reach, ship.getSize() + abs(ship.getVelocity().getDx()) +
+                                          abs(ship.getVelocity().getDy()));
+   }
+   shipGrid.build();
+   return reach;
+}
+
+/*********************************************
+ * GAME :: INDEXBULLETS
+ * The same for the bullets, which also go in
+ * an array so the grid can hold their order
+ *********************************************/
+float Game::indexBullets()
+{
+   float reach = 0.0;
+   bulletArray.clear();
+   for (list<Bullet*>::iterator bulletIt = bullets.begin();
+        bulletIt != bullets.end();
+        bulletIt++)
+   {
+      bulletGrid.add((int)bulletArray.size(), (*bulletIt)->getPosition());
+      bulletArray.push_back(*bulletIt);
+      reach = max(reach, (*bulletIt)->getSize() +
+                         abs((*bulletIt)->getVelocity().getDx()) +
+                         abs((*bulletIt)->getVelocity().getDy()));
+   }
+   bulletGrid.build();
+   return reach;
+}
+
+/*********************************************
+ * GAME :: FINDNEARBY
+ * Everything in a grid that could touch this
+ * object this tick, in the order it was added.
+ * Nothing can close more distance in a tick
+ * than both their sizes and both their speeds.
+ *********************************************/
+template <class T>
+void Game::findNearby(const SpatialGrid<T> & grid, const FlyingObject & obj,
+                      float reach)
+{
+   nearby.clear();
+   float range = obj.getSize() + abs(obj.getVelocity().getDx()) +
+                 abs(obj.getVelocity().getDy()) + reach + 1.0;
+   float x = obj.getPosition().getX();
+   float y = obj.getPosition().getY();
+   vector<int> & found = nearby;
+   auto collect = [&found](int item) { found.push_back(item); };
+   grid.query(x - range, y - range, x + range, y + range, collect);
+   sort(nearby.begin(), nearby.end());
+}
+
+/******************************************************
+ * Function: testCollision
+ * Description: isCollision(), counted for the metrics
+ ******************************************************/
+bool Game :: testCollision(const FlyingObject &obj1, const FlyingObject &obj2)
+{
+   collisionTests++;
+   bool collision = isCollision(obj1, obj2);
+   if (collision)
+      collisionHits++;
+   return collision;
 }
 
 /******************************************************
@@ -301,6 +1181,7 @@ float Game :: getClosestDistance(const FlyingObject &obj1, const FlyingObject &o
  *********************************************/
 void Game::cleanUpZombies()
 {
+   TRACE_SCOPE("Game::cleanUpZombies");
    // Look for dead debris
    list<Bullet*>::iterator debrisIt = debris.begin();
    while (debrisIt != debris.end())
@@ -369,16 +1250,10 @@ void Game::cleanUpZombies()
 ***************************************/
 void Game::createDebris(Point point, int size, int type)
 {
-   for (int i = 0; i < size * 15; i++)
-   {
-      Bullet *pDebris = new Bullet();
-      pDebris->setPosition(point);
-      pDebris->setRotation(random(0, 360));
-      pDebris->setSpeed(random(0.1, 3.0));
-      pDebris->setDistance(random(-10, 10));
-      pDebris->setType(type);
-      debris.push_back(pDebris);
-   }
+   if (resimulating)
+      return;
+   ALLOC_SCOPE("Game::createDebris");
+   Bullet::explode(debris, point, size, type);
 }
 
 
@@ -389,15 +1264,686 @@ void Game::createDebris(Point point, int size, int type)
  * engine will wait until the proper amount of
  * time has passed and put the drawing on the screen.
  **************************************/
+/*************************************
+ * STEP LOCKSTEP
+ * Play the next tick if the peer's keys are
+ * here, waiting up to waitMs for them, or
+ * with rollback, play it on a guess.  A
+ * broken session ends the game.
+ **************************************/
+static bool stepLockstep(Game & game, int keys, int waitMs)
+{
+   bool played;
+   if (Rollback::isActive())
+      played = Rollback::step(game, keys);
+   else
+   {
+      int playerKeys[LOCKSTEP_PLAYERS];
+      played = Lockstep::step(keys, playerKeys, waitMs);
+      if (played)
+      {
+         game.handleInput(playerKeys, LOCKSTEP_PLAYERS);
+         game.advance();
+         Lockstep::confirm(Lockstep::getTick() - 1, game.getStateHash());
+      }
+   }
+
+   if (Lockstep::isFailed())
+   {
+      cerr << "Lockstep: " << Lockstep::getError() << endl;
+      exit(1);
+   }
+   return played;
+}
+
 void callBack(const Interface *pUI, void *p)
 {
+   TRACE_SCOPE("callBack");
    Game *pGame = (Game *)p;
+   PerfCounters::beginFrame();
    
-   pGame->advance();
-   pGame->handleInput(*pUI);
+   AllocTracker::beginFrame();
+   if (Lockstep::isActive())
+   {
+      // a late peer only holds up the simulation, never the drawing
+      stepLockstep(*pGame, pGame->readInput(*pUI), 0);
+   }
+   else
+   {
+      int keys = pGame->readInput(*pUI);
+      ReplayRecorder::record(*pGame, &keys);
+      pGame->handleInput(keys);
+      pGame->advance();
+   }
+   EventBus::endFrame();
+   if (Broadcast::isOpen())
+      pGame->broadcast();
    pGame->draw(*pUI);
+   AllocTracker::endFrame();
+   if (Metrics::isServing())
+      pGame->updateMetrics(pUI->getRecentFrameTime(), pUI->getLastWorkTime());
+}
+
+/*********************************
+ * REPORT ALLOCATIONS
+ * Registered with atexit() when the user
+ * wants to see where the memory went.
+ *********************************/
+void reportAllocations()
+{
+   AllocTracker::report(cerr);
+}
+
+/*********************************
+ * REPORT LATENCY
+ * One line for a histogram of key
+ * latencies, in milliseconds
+ *********************************/
+static void reportLatency(const char * what, const FrameHistogram & latency)
+{
+   cerr << what << latency.getCount() << " keys, p50 "
+        << latency.getP50() / 1000000.0 << " ms, p99 "
+        << latency.getP99() / 1000000.0 << " ms, max "
+        << latency.getMax() / 1000000.0 << " ms" << endl;
+}
+
+/*********************************
+ * REPORT INPUT LATENCY
+ * Registered with atexit() along with the
+ * stats overlay, so the numbers outlast it.
+ *********************************/
+void reportInputLatency()
+{
+   reportLatency("Input to simulation: ", Interface::getInputToSimulation());
+   reportLatency("Input to photon:     ", Interface::getInputToPhoton());
+}
+
+/*********************************
+ * STOP CAPTURE
+ * Registered with atexit() when recording so
+ * the last frames reach the disk.
+ *********************************/
+void stopCapture()
+{
+   FrameCapture::stop();
+   FrameCapture::report(cerr);
+}
+
+
+/*********************************
+ * STOP EVENT LOG
+ * Registered with atexit() so the last
+ * events reach the file.
+ *********************************/
+void stopEventLog()
+{
+   EventLog::stop();
+}
+
+/*********************************
+ * STOP METRICS
+ * Registered with atexit() to close the
+ * socket on the way out.
+ *********************************/
+void stopMetrics()
+{
+   Metrics::stop();
+}
+
+/*********************************
+ * STOP TRACE
+ * Registered with atexit() to close the
+ * JSON off so the file loads.
+ *********************************/
+void stopTrace()
+{
+   Trace::stop();
+   if (Trace::getDropped() > 0)
+      cerr << "Trace dropped " << Trace::getDropped() << " spans" << endl;
+}
+
+/*********************************
+ * REPORT PERF COUNTERS
+ * Registered with atexit() when sampling
+ * the hardware counters.
+ *********************************/
+void reportPerfCounters()
+{
+   PerfCounters::writeJson(cerr);
+   cerr << endl;
+   PerfCounters::stop();
+}
+
+/*********************************
+ * STOP LOCKSTEP
+ * Registered with atexit() so the peer
+ * gets our last keys.
+ *********************************/
+void stopLockstep()
+{
+   Lockstep::stop();
+}
+
+/*********************************
+ * STOP BROADCAST
+ * Registered with atexit() so the viewers
+ * know we are gone and the file goes too.
+ *********************************/
+void stopBroadcast()
+{
+   Broadcast::close();
+}
+
+/*********************************
+ * STOP RECORDING
+ * Registered with atexit() so the replay
+ * gets its index.
+ *********************************/
+void stopRecording()
+{
+   ReplayRecorder::stop();
+}
+
+/*********************************
+ * LOCKSTEP SETTINGS
+ * Everything on the command line that
+ * changes how the game plays out.  Both
+ * peers must have the same.
+ *********************************/
+static unsigned int lockstepSettings(const Options & options)
+{
+   int values[] = { options.rockCount, (int)options.worldSize, options.bots,
+                    options.bots > 0 ? options.autopilot : 0,
+                    options.bots > 0 ? options.aggression : 0 };
+   unsigned int hash = 2166136261u;
+   for (size_t i = 0; i < sizeof(values) / sizeof(values[0]); i++)
+   {
+      hash ^= (unsigned int)values[i];
+      hash *= 16777619u;
+   }
+   return hash;
+}
+
+/*********************************
+ * ADD PLAYERS
+ * The peer's ship when playing lockstep,
+ * the autopilot if asked for, and the bots
+ *********************************/
+static void addPlayers(Game & game, const Options & options,
+                       Autopilot & autopilot)
+{
+   if (Lockstep::isActive())
+   {
+      game.addPlayer(Point(World::getXMax() / 2, 0));
+      game.setViewer(Lockstep::getSide());
+   }
+   if (options.autopilot >= 0)
+      game.setAutopilot(&autopilot);
+   game.addBots(options.bots,
+                options.autopilot >= 0 ? options.autopilot : AUTOPILOT_DEFAULT_KNOB,
+                options.aggression);
+}
+
+/*********************************
+ * RUN HEADLESS
+ * Play without a window for a set number
+ * of ticks, with the autopilot at the keys
+ * if asked for, and print the state hash.
+ * Two lockstep peers run this way print
+ * the same hash.
+ *********************************/
+static int runHeadless(const Options & options, unsigned int seed)
+{
+   Point worldTopLeft(-options.worldSize, options.worldSize);
+   Point worldBottomRight(options.worldSize, -options.worldSize);
+   Game game(worldTopLeft, worldBottomRight, options.rockCount);
+   Autopilot autopilot(options.autopilot, options.aggression);
+   addPlayers(game, options, autopilot);
+   int viewer = Lockstep::isActive() ? Lockstep::getSide() : 0;
+
+   for (int tick = 0; tick < options.headless; tick++)
+   {
+      long long frameStart = monotonicNow();
+      AllocTracker::beginFrame();
+      PerfCounters::beginFrame();
+      int keys = options.autopilot >= 0 ? autopilot.decide(game, viewer) : 0;
+      if (Lockstep::isActive())
+      {
+         while (!stepLockstep(game, keys, LOCKSTEP_TIMEOUT_MS))
+            sleepFor(1000000);
+      }
+      else
+      {
+         ReplayRecorder::record(game, &keys);
+         game.handleInput(keys);
+         game.advance();
+      }
+      EventBus::endFrame();
+      if (Broadcast::isOpen())
+         game.broadcast();
+      AllocTracker::endFrame();
+
+      // nothing paces it, so the whole frame is work
+      if (Metrics::isServing())
+      {
+         long long frameTime = monotonicNow() - frameStart;
+         game.updateMetrics(frameTime, frameTime);
+      }
+   }
+   ReplayRecorder::stop();
+
+   // with rollback the last few ticks may still be guesses
+   if (Rollback::isActive() && !Rollback::settle(game))
+   {
+      cerr << "Lockstep: " << Lockstep::getError() << endl;
+      return 1;
+   }
+   int stalls = Lockstep::getStalls() + Rollback::getStalls();
+   Lockstep::stop();
+
+   char hex[32];
+   snprintf(hex, sizeof(hex), "\"%016llx\"", game.getStateHash());
+   cout << "{\"seed\":" << seed
+        << ",\"ticks\":" << options.headless
+        << ",\"side\":" << viewer
+        << ",\"stalls\":" << stalls
+        << ",\"rollbacks\":" << Rollback::getRollbacks()
+        << ",\"resimulated\":" << Rollback::getResimulated()
+        << ",\"score\":" << game.getScore(viewer)
+        << ",\"hash\":" << hex << "}" << endl;
+   return 0;
+}
+
+/*********************************
+ * RUN SERVER
+ * The one real copy of the game, for clients
+ * to fly in and watch.  Nothing is drawn, so
+ * it keeps its own time.  -headless stops it
+ * after that many ticks
+ *********************************/
+static int runServer(const Options & options, unsigned int seed)
+{
+   Point worldTopLeft(-options.worldSize, options.worldSize);
+   Point worldBottomRight(options.worldSize, -options.worldSize);
+   Game game(worldTopLeft, worldBottomRight, options.rockCount);
+   Autopilot autopilot(options.autopilot, options.aggression);
+   addPlayers(game, options, autopilot);
+   if (!Server::start(options.servePort))
+   {
+      cerr << "Unable to serve on port " << options.servePort << endl;
+      return 1;
+   }
+
+   FramePacer pacer;
+   pacer.setFramesPerSecond(options.fps);
+   vector<int> keys;
+   int tick;
+   for (tick = 0; options.headless == 0 || tick < options.headless; tick++)
+   {
+      pacer.beginWork();
+      PerfCounters::beginFrame();
+      AllocTracker::beginFrame();
+      Server::receive(game);
+      keys.resize(game.getPlayerCount());
+      for (size_t i = 0; i < keys.size(); i++)
+         keys[i] = Server::getKeys((int)i);
+      if (options.autopilot >= 0)
+         keys[0] = autopilot.decide(game, 0);
+      game.handleInput(keys.data(), (int)keys.size());
+      game.advance();
+      EventBus::endFrame();
+      if (Broadcast::isOpen())
+         game.broadcast();
+      Server::send(game);
+      AllocTracker::endFrame();
+      pacer.endWork();
+      if (Metrics::isServing())
+         game.updateMetrics(pacer.getRecentFrameTime(), pacer.getLastWorkTime());
+
+      pacer.wait();
+      pacer.setNextDrawTime();
+   }
+
+   char hex[32];
+   snprintf(hex, sizeof(hex), "\"%016llx\"", game.getStateHash());
+   cout << "{\"seed\":" << seed
+        << ",\"ticks\":" << tick
+        << ",\"clients\":" << Server::getClientCount()
+        << ",\"snapshots\":" << Server::getSnapshotsSent()
+        << ",\"bytes\":" << Server::getBytesSent()
+        << ",\"hash\":" << hex << "}" << endl;
+   Server::stop();
+   return 0;
+}
+
+/*********************************
+ * CLIENT CALLBACK
+ * Like callBack(), but the game is on the
+ * server: send the keys, draw what came back
+ *********************************/
+void clientCallBack(const Interface *pUI, void *p)
+{
+   NetClient * pClient = (NetClient *)p;
+   pClient->setKeys(Game::readKeys(*pUI));
+   pClient->poll();
+   pClient->draw(*pUI);
+}
+
+/*********************************
+ * RUN CLIENT
+ * Show a server's game.  With -headless,
+ * just take snapshots for a while and say
+ * how it went
+ *********************************/
+static int runClient(int argc, char ** argv, const Options & options)
+{
+   // the server sends what the screen can reach, whatever the zoom
+   NetClient client;
+   int range = (int)(WINDOW_X_SIZE * options.zoom) + BIG_ROCK_SIZE * 2;
+   if (!client.connect(options.server, options.watch, range))
+   {
+      cerr << "Cannot find " << options.server << endl;
+      return 1;
+   }
+   long long deadline = monotonicNow() + CLIENT_CONNECT_MS * 1000000LL;
+   while (!client.isWelcome())
+   {
+      if (monotonicNow() > deadline)
+      {
+         cerr << "No answer from " << options.server << endl;
+         return 1;
+      }
+      sleepFor(1000000);
+      client.poll();
+   }
+
+   if (options.headless > 0)
+   {
+      FramePacer pacer;
+      pacer.setFramesPerSecond(options.fps);
+      for (int tick = 0; tick < options.headless && !client.isClosed(); tick++)
+      {
+         client.poll();
+         pacer.wait();
+         pacer.setNextDrawTime();
+      }
+      cout << "{\"player\":" << client.getPlayer()
+           << ",\"newest\":" << client.getNewestTick()
+           << ",\"snapshots\":" << client.getSnapshots()
+           << ",\"lost\":" << client.getLost()
+           << ",\"bytes\":" << client.getBytesReceived()
+           << ",\"score\":" << client.getScore() << "}" << endl;
+      return 0;
+   }
+
+   float size = client.getWorldSize();
+   World::setBounds(Point(-size, size), Point(size, -size));
+   Point topLeft(-WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   Point bottomRight(WINDOW_X_SIZE, -WINDOW_Y_SIZE);
+   Interface ui(argc, argv, "Asteroids", topLeft, bottomRight);
+   ui.setFramesPerSecond(options.fps);
+   client.getCamera().setSize(WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   client.getCamera().setZoom(options.zoom);
+   QualityGovernor::pin(options.quality);
+   ui.run(clientCallBack, &client);
+   return 0;
+}
+
+/*********************************
+ * SPECTATOR
+ * What a spectator's window needs
+ *********************************/
+struct Spectator
+{
+   BroadcastView           view;
+   vector<BroadcastEntity> entities;   // the newest frame
+   long long               frame;
+   Camera                  camera;
+};
+
+/*********************************
+ * SPECTATOR CALLBACK
+ * Draw the newest frame the game has
+ * published, all of the arena at once
+ *********************************/
+void spectatorCallBack(const Interface *, void *p)
+{
+   Spectator * pSpectator = (Spectator *)p;
+   long long frame = pSpectator->view.read(pSpectator->entities);
+   if (frame >= 0)
+      pSpectator->frame = frame;
+
+   pSpectator->camera.applyWorld();
+   LevelOfDetail::setScale(pSpectator->camera.getScale());
+   for (size_t i = 0; i < pSpectator->entities.size(); i++)
+   {
+      const BroadcastEntity & e = pSpectator->entities[i];
+      Point point(e.x, e.y);
+      switch (e.kind)
+      {
+         case BROADCAST_SHIP:
+            if (e.detail & BROADCAST_ALIVE)
+               drawShip(point, e.rotation, (e.detail & BROADCAST_THRUSTING) != 0);
+            break;
+         case BROADCAST_ROCK:
+         {
+            const RockTier & tier = ROCK_TIERS[e.detail < ROCK_TIER_COUNT ? e.detail : ROCK_SMALL];
+            drawAsteroid(tier.mesh, point, e.rotation, LevelOfDetail::select(tier.size));
+            break;
+         }
+         default:
+            batchDot(point, e.red / 255.0, e.green / 255.0, e.blue / 255.0);
+            break;
+      }
+   }
+   flushMeshes();
+   flushBatches();
+
+   pSpectator->camera.applyScreen();
+   drawNumber(Point(pSpectator->camera.getScreenXMin() + 10,
+                    pSpectator->camera.getScreenYMax() - 10),
+              (int)pSpectator->frame);
+   if (!pSpectator->view.isLive())
+      drawStaticText(Point(-60, 0), "The game went away");
+}
+
+/*********************************
+ * RUN SPECTATOR
+ * Watch a game on this machine through its
+ * broadcast.  With -headless, just read
+ * frames for a while and say how it went
+ *********************************/
+static int runSpectator(int argc, char ** argv, const Options & options)
+{
+   Spectator spectator;
+   spectator.frame = -1;
+   long long deadline = monotonicNow() + CLIENT_CONNECT_MS * 1000000LL;
+   while (!spectator.view.attach(options.spectate))
+   {
+      if (monotonicNow() > deadline)
+      {
+         cerr << "Nothing broadcast as " << options.spectate << endl;
+         return 1;
+      }
+      sleepFor(10000000);
+   }
+
+   if (options.headless > 0)
+   {
+      FramePacer pacer;
+      pacer.setFramesPerSecond(options.fps);
+      long long frames = 0;
+      for (int tick = 0; tick < options.headless && spectator.view.isLive(); tick++)
+      {
+         long long frame = spectator.view.read(spectator.entities);
+         if (frame >= 0)
+         {
+            spectator.frame = frame;
+            frames++;
+         }
+         pacer.wait();
+         pacer.setNextDrawTime();
+      }
+      cout << "{\"frames\":" << frames
+           << ",\"newest\":" << spectator.frame
+           << ",\"skipped\":" << spectator.view.getSkipped()
+           << ",\"torn\":" << spectator.view.getTorn()
+           << ",\"entities\":" << spectator.entities.size()
+           << ",\"live\":" << (spectator.view.isLive() ? "true" : "false")
+           << "}" << endl;
+      return 0;
+   }
+
+   // the whole arena on the screen
+   float size = spectator.view.getWorldX();
+   if (spectator.view.getWorldY() > size)
+      size = spectator.view.getWorldY();
+   Point topLeft(-WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   Point bottomRight(WINDOW_X_SIZE, -WINDOW_Y_SIZE);
+   Interface ui(argc, argv, "Asteroids", topLeft, bottomRight);
+   ui.setFramesPerSecond(options.fps);
+   spectator.camera.setSize(WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   spectator.camera.setZoom(size > WINDOW_X_SIZE ? size / WINDOW_X_SIZE : 1.0);
+   ui.run(spectatorCallBack, &spectator);
+   return 0;
+}
+
+/*********************************
+ * REPLAY VIEWER
+ * What a replay's window needs
+ *********************************/
+struct ReplayViewer
+{
+   ReplayReader reader;
+   Game *       pGame;
+   bool         wasLeft;    // so holding an arrow jumps once
+   bool         wasRight;
+};
+
+/*********************************
+ * REPLAY CALLBACK
+ * Like callBack(), but the keys come from
+ * the recording.  The arrows jump about
+ *********************************/
+void replayCallBack(const Interface *pUI, void *p)
+{
+   ReplayViewer * pViewer = (ReplayViewer *)p;
+   ReplayReader & reader = pViewer->reader;
+   bool left  = pUI->isLeft()  != 0;
+   bool right = pUI->isRight() != 0;
+   int  jump  = 0;
+   if (left && !pViewer->wasLeft)
+      jump = -REPLAY_JUMP_TICKS;
+   if (right && !pViewer->wasRight)
+      jump = REPLAY_JUMP_TICKS;
+   pViewer->wasLeft  = left;
+   pViewer->wasRight = right;
+
+   if (jump != 0)
+   {
+      int tick = reader.getTick() + jump;
+      if (tick < 0)
+         tick = 0;
+      if (tick > reader.getHeader().ticks)
+         tick = reader.getHeader().ticks;
+      reader.seek(*pViewer->pGame, tick);
+   }
+   else
+      reader.step(*pViewer->pGame);
+   EventBus::endFrame();
+   pViewer->pGame->draw(*pUI);
 }
 
+/*********************************
+ * RUN REPLAY
+ * Play a recording back in a window.  With
+ * -headless, time that many seeks spread
+ * over it instead, then go to -seek or the
+ * end and print the hash, which at the end
+ * must be what the recording finished with
+ *********************************/
+static int runReplay(int argc, char ** argv, const Options & options)
+{
+   ReplayViewer viewer;
+   if (!viewer.reader.open(options.replay))
+   {
+      cerr << "Cannot read a replay from " << options.replay << endl;
+      return 1;
+   }
+   ReplayReader & reader = viewer.reader;
+   const ReplayHeader & header = reader.getHeader();
+   viewer.pGame    = reader.createGame();
+   viewer.wasLeft  = false;
+   viewer.wasRight = false;
+   int tick = options.seek >= 0 ? options.seek : header.ticks;
+   if (tick > header.ticks)
+   {
+      cerr << "The replay is only " << header.ticks << " ticks long" << endl;
+      return 1;
+   }
+
+   if (options.headless > 0)
+   {
+      long long total = 0;
+      long long worst = 0;
+      for (int i = 0; i < options.headless; i++)
+      {
+         // scattered, but the same every run
+         int target = (int)((i * 2654435761ULL) % (header.ticks + 1));
+         long long start = monotonicNow();
+         if (!reader.seek(*viewer.pGame, target))
+         {
+            cerr << "The replay is damaged near tick " << target << endl;
+            return 1;
+         }
+         long long took = monotonicNow() - start;
+         total += took;
+         if (took > worst)
+            worst = took;
+      }
+      if (!reader.seek(*viewer.pGame, tick))
+      {
+         cerr << "The replay is damaged near tick " << tick << endl;
+         return 1;
+      }
+
+      char hex[32];
+      snprintf(hex, sizeof(hex), "\"%016llx\"", viewer.pGame->getStateHash());
+      cout << "{\"ticks\":" << header.ticks
+           << ",\"keyframes\":" << header.keyframes
+           << ",\"bytes\":" << reader.getBytes()
+           << ",\"seeks\":" << options.headless
+           << ",\"mean_seek_ms\":" << total / 1000000.0 / options.headless
+           << ",\"worst_seek_ms\":" << worst / 1000000.0
+           << ",\"tick\":" << tick
+           << ",\"hash\":" << hex;
+      bool match = true;
+      if (tick == header.ticks)
+      {
+         match = viewer.pGame->getStateHash() == header.hash;
+         snprintf(hex, sizeof(hex), "\"%016llx\"", header.hash);
+         cout << ",\"expected\":" << hex
+              << ",\"match\":" << (match ? "true" : "false");
+      }
+      cout << "}" << endl;
+      delete viewer.pGame;
+      return match ? 0 : 1;
+   }
+
+   if (options.seek < 0)
+      tick = 0;
+   reader.seek(*viewer.pGame, tick);
+   Point topLeft(-WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   Point bottomRight(WINDOW_X_SIZE, -WINDOW_Y_SIZE);
+   Interface ui(argc, argv, "Asteroids", topLeft, bottomRight);
+   ui.setFramesPerSecond(options.fps);
+   viewer.pGame->getCamera().setSize(WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   viewer.pGame->getCamera().setZoom(options.zoom);
+   viewer.pGame->setShowStats(options.showStats);
+   QualityGovernor::pin(options.quality);
+   ui.run(replayCallBack, &viewer);
+   return 0;
+}
 
 /*********************************
  * Main is pretty sparse.  Just initialize
@@ -406,11 +1952,154 @@ void callBack(const Interface *pUI, void *p)
  *********************************/
 int main(int argc, char ** argv)
 {
+   Options options;
+   if (!options.parse(argc, argv))
+   {
+      options.usage(argv[0]);
+      return 1;
+   }
+
+   AllocTracker::setBudget(options.allocBudget, options.allocAbort);
+   if (options.allocReport)
+      atexit(reportAllocations);
+
+   // a benchmark plays canned sessions without ever opening a window
+   if (options.benchCount > 0)
+   {
+      if (options.perfInterval > 0 && !PerfCounters::start(options.perfInterval))
+         cerr << "Hardware counters are not available, -perf ignored" << endl;
+      return Benchmark::runAll(options.benchCount, options.benchFiles, cout);
+   }
+
+   // neither has a spectator
+   if (options.server)
+      return runClient(argc, argv, options);
+   if (options.spectate)
+      return runSpectator(argc, argv, options);
+   if (options.replay)
+      return runReplay(argc, argv, options);
+
+   if (options.broadcast)
+   {
+      if (!Broadcast::open(options.broadcast))
+      {
+         cerr << "Unable to broadcast as " << options.broadcast << endl;
+         return 1;
+      }
+      Broadcast::setWorld(options.worldSize, options.worldSize);
+      atexit(stopBroadcast);
+   }
+
+   // the simulation's seed, which the peer picks when we are side 1
+   unsigned int seed = options.seed >= 0 ? (unsigned int)options.seed
+                                         : (unsigned int)time(NULL);
+   if (options.lockstepPeer)
+   {
+      if (!Lockstep::connect(options.lockstepSide, options.lockstepPort,
+                             options.lockstepPeer, options.delay,
+                             lockstepSettings(options), seed))
+      {
+         cerr << "Lockstep: " << Lockstep::getError() << endl;
+         return 1;
+      }
+      atexit(stopLockstep);
+      if (options.rollback > 0)
+         Rollback::start(options.rollback);
+   }
+   SimRandom::seed(seed);
+
+   if (options.record)
+   {
+      if (Lockstep::isActive() || options.servePort > 0)
+      {
+         cerr << "Only a game played here alone can be recorded" << endl;
+         return 1;
+      }
+      if (!ReplayRecorder::start(options.record, seed, options.worldSize,
+                                 options.rockCount, 1, options.bots,
+                                 options.autopilot >= 0 ? options.autopilot
+                                                        : AUTOPILOT_DEFAULT_KNOB,
+                                 options.aggression))
+      {
+         cerr << "Unable to open " << options.record << endl;
+         return 1;
+      }
+      atexit(stopRecording);
+   }
+
+   // the server and a headless game are watched the same way as a window
+   if (options.events)
+   {
+      if (!EventLog::start(options.events))
+      {
+         cerr << "Unable to open " << options.events << endl;
+         return 1;
+      }
+      atexit(stopEventLog);
+   }
+
+   if (options.trace)
+   {
+      if (!Trace::start(options.trace))
+      {
+         cerr << "Unable to open " << options.trace << endl;
+         return 1;
+      }
+      atexit(stopTrace);
+   }
+
+   if (options.perfInterval > 0)
+   {
+      if (PerfCounters::start(options.perfInterval))
+         atexit(reportPerfCounters);
+      else
+         cerr << "Hardware counters are not available, -perf ignored" << endl;
+   }
+
+   if (options.metrics)
+   {
+      if (!Metrics::serve(options.metrics))
+      {
+         cerr << "Unable to serve metrics on " << options.metrics << ": "
+              << Metrics::getError() << endl;
+         return 1;
+      }
+      atexit(stopMetrics);
+   }
+
+   if (options.servePort > 0)
+      return runServer(options, seed);
+   if (options.headless > 0)
+      return runHeadless(options, seed);
+
+   // the window is always the same size, no matter how big the world is
    Point topLeft(-WINDOW_X_SIZE, WINDOW_Y_SIZE);
    Point bottomRight(WINDOW_X_SIZE, -WINDOW_Y_SIZE);
-
    Interface ui(argc, argv, "Asteroids", topLeft, bottomRight);
-   Game game(topLeft, bottomRight);
+   ui.setFramesPerSecond(options.fps);
+
+   if (options.capture)
+   {
+      if (!FrameCapture::start(options.capture, WINDOW_X_SIZE * 2,
+                               WINDOW_Y_SIZE * 2, options.fps))
+      {
+         cerr << "Unable to open " << options.capture << endl;
+         return 1;
+      }
+      atexit(stopCapture);
+   }
+
+   Point worldTopLeft(-options.worldSize, options.worldSize);
+   Point worldBottomRight(options.worldSize, -options.worldSize);
+   Game game(worldTopLeft, worldBottomRight, options.rockCount);
+   game.getCamera().setSize(WINDOW_X_SIZE, WINDOW_Y_SIZE);
+   game.getCamera().setZoom(options.zoom);
+   game.setShowStats(options.showStats);
+   if (options.showStats)
+      atexit(reportInputLatency);
+   Autopilot autopilot(options.autopilot, options.aggression);
+   addPlayers(game, options, autopilot);
+   QualityGovernor::pin(options.quality);
    ui.run(callBack, &game);
    
    return 0;
@@ -19,17 +19,46 @@
 #include "uiDraw.h"
 #include "uiInteract.h"
 #include "point.h"
+#include "world.h"
+#include "camera.h"
+#include "spatialGrid.h"
 
 #include "flyingObject.h"
 #include "ship.h"
 #include "rocks.h"
 #include "bullet.h"
+#include "eventBus.h"
+#include "autopilot.h"
+#include "gameState.h"
+#include "snapshot.h"
 
 #include <list>
+#include <vector>
 using namespace std;
 
 #define INITIAL_ROCK_COUNT 5
+#define CULL_MARGIN        40   // farthest anything draws from its position
 
+// the keys held on one tick, as bits, so a script can play the game
+#define INPUT_LEFT   0x01
+#define INPUT_RIGHT  0x02
+#define INPUT_UP     0x04
+#define INPUT_DOWN   0x08
+#define INPUT_SPACE  0x10
+#define INPUT_R      0x20
+
+/*****************************************
+ * PLAYER
+ * A ship and whoever is flying it
+ *****************************************/
+struct Player
+{
+   Ship *      pShip;
+   Autopilot * pPilot;   // NULL when it is the keyboard
+   bool        isBot;    // pPilot is ours: addBots() made it
+   Point       spawn;    // where the ship comes back after dying
+   int         score;    // points for every rock it shot
+};
 
 /*****************************************
  * GAME
@@ -39,64 +68,180 @@ class Game
 {
 public:
    // create the game
-   Game(Point tl, Point br)
+   Game(Point tl, Point br, int rockCount = INITIAL_ROCK_COUNT)
+      : viewer(0), resimulating(false), drawn(0), stateChanges(0),
+        collisionTests(0), collisionHits(0), tickTime(0), dotsIndexed(false),
+        showStats(false)
    {
-      topLeft = tl;
-      bottomRight = br;
+      World::setBounds(tl, br);
+      rockGrid.reset(World::getXMin(), World::getYMin(),
+                     World::getXMax(), World::getYMax());
+      starGrid.reset(World::getXMin(), World::getYMin(),
+                     World::getXMax(), World::getYMax());
+      dotGrid.reset(World::getXMin(), World::getYMin(),
+                    World::getXMax(), World::getYMax());
+      shipGrid.reset(World::getXMin(), World::getYMin(),
+                     World::getXMax(), World::getYMax());
+      bulletGrid.reset(World::getXMin(), World::getYMin(),
+                       World::getXMax(), World::getYMax());
       
-      pShip = new Ship;
+      Player player = { new Ship, NULL, false, Point(0, 0), 0 };
+      player.pShip->setOwner(0);
+      players.push_back(player);
       
-      for (int i = 0; i < INITIAL_ROCK_COUNT; i++)
+      for (int i = 0; i < rockCount; i++)
       {
-         rocks.push_back(new BigRock(getRandomPoint()));
+         rocks.push_back(new Rocks(ROCK_BIG, getRandomPoint()));
+         EventBus::publish(EVENT_ROCK_SPAWNED, rocks.back()->getPosition(),
+                           ROCK_BIG);
       }
-	  for (int i = 0; i < 100; i++)
-	  {
-		  Bullet *pBullet = new Bullet();
-		  pBullet->setSpeed(0);
-		  pBullet->setPosition(Point(random(-200, 200), random(-200, 200)));
-		  pBullet->setType(2);
-		  pBullet->setLives(random(30, 250));
-		  stars.push_back(pBullet);
-	  }
+	  Bullet::scatterStars(stars, BULLET_STARS);
+	  buildIndex();
    }
    
+   ~Game();
+
    // handle user input
    void handleInput(const Interface & ui);
+
+   // the keys for player 0; the bots decide for themselves
+   void handleInput(int keys);
+
+   // the keys for the first count players, from wherever they came.
+   // The rest, and every bot, fly themselves
+   void handleInput(const int keys[], int count);
+
+   // what the one at this screen is pressing, or its autopilot
+   int readInput(const Interface & ui);
+   // just the keyboard, as INPUT_* bits
+   static int readKeys(const Interface & ui);
+
+   // more ships, each flown by its own autopilot, starting at random
+   // spots.  Each one's bullets can hit every other ship
+   void addBots(int count, int difficulty, int aggression);
+
+   // another ship whose keys come from somewhere else, like a peer
+   void addPlayer(const Point & spawn);
+
+   // which player is on this screen: the camera follows it and the
+   // score is its score
+   void setViewer(int player) { viewer = player; }
    
    // advance the game
    void advance();
    
    // draw stuff
    void draw(const Interface & ui);
+
+   // let the autopilot fly instead of the keyboard, NULL for a person
+   void setAutopilot(Autopilot * pAutopilot) { players[viewer].pPilot = pAutopilot; }
+
+   // show the frame time and entity counters?
+   void setShowStats(bool show) { showStats = show; }
+
+   // copy this frame's counters out to the metrics server, along with
+   // how long the frame took and how much of it was work
+   void updateMetrics(long long frameTime, long long workTime);
+
+   int getScore(int player = 0) const { return players[player].score; }
+
+   // nanoseconds the last advance() took
+   long long getTickTime() const { return tickTime; }
+
+   // ships, rocks and bullets: what a tick has to simulate
+   int getSimulatedCount() const
+   {
+      return (int)(players.size() + rocks.size() + bullets.size());
+   }
+
+   // a fingerprint of the simulation, to tell whether two runs match
+   unsigned long long getStateHash() const;
+
+   // copy everything that decides how the game plays out into a
+   // GameState, and put it all back.  Loading leaves the eye candy be
+   void saveState(GameState & state) const;
+   void loadState(const GameState & state);
+
+   // playing ticks over again after a rollback: they were already
+   // seen and heard, so no debris, trails or events this time
+   void setResimulating(bool resimulating);
+
+   // what a client is shown this tick: every ship, rock and bullet,
+   // quantised and in order of id
+   void captureSnapshot(Snapshot & snapshot, int tick) const;
+
+   // this frame to the spectators watching through Broadcast
+   void broadcast() const;
    
-   static int getXMin() { return topLeft.getX(); }
-   static int getXMax() { return bottomRight.getX(); }
-   static int getYMin() { return bottomRight.getY(); }
-   static int getYMax() { return topLeft.getY(); }
+   static int getXMin() { return World::getXMin(); }
+   static int getXMax() { return World::getXMax(); }
+   static int getYMin() { return World::getYMin(); }
+   static int getYMax() { return World::getYMax(); }
+
+   // what part of the world is on the screen
+   Camera & getCamera() { return camera; }
+
+   // for players that are not at the keyboard
+   int getPlayerCount() const { return (int)players.size(); }
+   const Ship & getShip(int player = 0) const { return *players[player].pShip; }
+   const SpatialGrid<Rocks*> & getRockGrid() const { return rockGrid; }
    
 private:
-   static Point topLeft;
-   static Point bottomRight;
+   Camera camera;
    
-   Ship* pShip;
+   vector<Player> players;
+   int viewer;               // which one is on the screen
+   bool resimulating;        // replaying ticks after a rollback
    
    list<Bullet*> bullets;
    list<Bullet*> debris;
    list<Bullet*> stars;
    list<Rocks*> rocks;
+
+   // where everything is, rebuilt every tick
+   SpatialGrid<Rocks*>  rockGrid;
+   SpatialGrid<Bullet*> starGrid;   // thinned out when quality drops
+   SpatialGrid<Bullet*> dotGrid;    // debris and bullets
+
+   // broad phase for the collisions, rebuilt every check
+   SpatialGrid<int>     shipGrid;     // index into players
+   SpatialGrid<int>     bulletGrid;   // index into bulletArray
+   vector<Bullet*>      bulletArray;  // bullets in list order
+   vector<int>          nearby;       // what a query found
+   int drawn;                       // things that made it past the cull
+   int stateChanges;                // sent to OpenGL in the last frame
+   int collisionTests;              // pairs tested in the last tick
+   int collisionHits;               // of those, pairs touching
+   long long tickTime;              // nanoseconds in the last advance()
+   bool dotsIndexed;                // false when a restore moved the bullets
+
+   bool showStats;   // draw the counters in the corner
    
    float min(float distance, float d1) const;
    float max(float distance, float d1) const;
    Point getRandomPoint() const;
  
+   void applyInput(int player, int keys);
    void checkForCollisions();
+   float indexShips();
+   float indexBullets();
+   template <class T>
+   void findNearby(const SpatialGrid<T> & grid, const FlyingObject & obj,
+                   float reach);
    void cleanUpZombies();
+   void buildIndex();
+   void indexRocks();
+   void indexDots();
    
    bool isCollision(const FlyingObject &obj1, const FlyingObject &obj2) const;
+   bool testCollision(const FlyingObject &obj1, const FlyingObject &obj2);
+   int countEntities() const;
+   int countShips() const;
    float getClosestDistance(const FlyingObject &obj1, const FlyingObject &obj2) const;
 
    void createDebris(Point point, int size, int type);
+
+   void drawOverlay(const Interface & ui);
    
 };
 
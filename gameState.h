@@ -0,0 +1,105 @@
+/***********************************************************************
+ * Header File:
+ *    Game State : the whole simulation as plain values
+ * Summary:
+ *    The game itself keeps its rocks and bullets as lists of pointers,
+ *    which is handy for playing but no good for going back in time.
+ *    A GameState is the same simulation flattened into three arrays of
+ *    small structs: no pointers, nothing to follow, so saving one is a
+ *    few straight copies and a saved one can be kept around for as
+ *    long as we like.  Once its arrays have grown, saving into the
+ *    same GameState again does not allocate.
+ *
+ *    Only what decides how the game plays out is kept.  Stars, debris
+ *    and the ships' trails are eye candy and carry on as they are.
+ *    The ids go too, and the next one to hand out, so a rock is the
+ *    same rock to a client however often its ticks are played again.
+ ************************************************************************/
+
+#ifndef GAME_STATE_H
+#define GAME_STATE_H
+
+#include <vector>
+
+/*********************************************
+ * SHIP STATE
+ * One player: the ship, the score, and if a
+ * bot flies it, the bot's counters
+ *********************************************/
+struct ShipState
+{
+   float x;
+   float y;
+   float dx;
+   float dy;
+   int   rotation;
+   int   lives;
+   int   weapon;
+   int   score;
+   int   pilotDeadTicks;
+   int   pilotCoolDown;
+};
+
+/*********************************************
+ * ROCK STATE
+ *********************************************/
+struct RockState
+{
+   float         x;
+   float         y;
+   float         dx;
+   float         dy;
+   int           rotation;
+   int           angle;
+   int           lives;
+   unsigned int  id;
+   unsigned char tier;
+   unsigned char direction;
+   unsigned char collision;
+   unsigned char unused;      // always 0, so no byte is left undefined
+};
+
+/*********************************************
+ * BULLET STATE
+ *********************************************/
+struct BulletState
+{
+   float x;
+   float y;
+   float dx;
+   float dy;
+   float speed;
+   int   rotation;
+   int   lives;
+   int   size;
+   int   distance;
+   unsigned int id;
+   short owner;
+   char  type;
+   char  weapon;
+};
+
+/*********************************************
+ * GAME STATE
+ * Filled by Game::saveState() and handed back
+ * to Game::loadState()
+ *********************************************/
+struct GameState
+{
+   std::vector<ShipState>   ships;     // one per player, in order
+   std::vector<RockState>   rocks;     // in list order
+   std::vector<BulletState> bullets;   // in list order
+   unsigned long long       random;    // SimRandom's state
+   unsigned int             nextId;    // FlyingObject's
+
+   // how much memory the state is using
+   size_t getBytes() const
+   {
+      return sizeof(GameState) +
+             ships.size()   * sizeof(ShipState) +
+             rocks.size()   * sizeof(RockState) +
+             bullets.size() * sizeof(BulletState);
+   }
+};
+
+#endif // GAME_STATE_H
@@ -0,0 +1,57 @@
+/***********************************************************************
+ * Source File:
+ *    Input Queue : key transitions waiting to be handled
+ * Summary:
+ *    The producer only ever writes head and the consumer only ever writes
+ *    tail.  Release on the write and acquire on the read is all it takes
+ *    for the other side to see a complete event.
+ ************************************************************************/
+
+#include "inputQueue.h"
+
+/******************************************************************
+ * INPUT QUEUE : PUSH
+ * Called from the GLUT callbacks.
+ *   INPUT   event   the key transition to remember
+ *   OUTPUT  <return> false if there was no room and it was dropped
+ ****************************************************************/
+bool InputQueue::push(const InputEvent & event)
+{
+   unsigned int h = head.load(std::memory_order_relaxed);
+   if (h - tail.load(std::memory_order_acquire) >= INPUT_QUEUE_SIZE)
+   {
+      dropped.fetch_add(1, std::memory_order_relaxed);
+      return false;
+   }
+
+   events[h & (INPUT_QUEUE_SIZE - 1)] = event;
+   head.store(h + 1, std::memory_order_release);
+   return true;
+}
+
+/******************************************************************
+ * INPUT QUEUE : PEEK
+ * Look at the oldest event.
+ *   OUTPUT  event    a copy of the oldest event
+ *           <return> false if the queue is empty
+ ****************************************************************/
+bool InputQueue::peek(InputEvent & event) const
+{
+   unsigned int t = tail.load(std::memory_order_relaxed);
+   if (t == head.load(std::memory_order_acquire))
+      return false;
+
+   event = events[t & (INPUT_QUEUE_SIZE - 1)];
+   return true;
+}
+
+/******************************************************************
+ * INPUT QUEUE : POP
+ * We are done with the oldest event.  Only call after a peek()
+ * returned true.
+ ****************************************************************/
+void InputQueue::pop()
+{
+   unsigned int t = tail.load(std::memory_order_relaxed);
+   tail.store(t + 1, std::memory_order_release);
+}
@@ -0,0 +1,57 @@
+/***********************************************************************
+ * Header File:
+ *    Input Queue : key transitions waiting to be handled
+ * Summary:
+ *    The GLUT callbacks push every key press and release here along with
+ *    the time it happened.  The game drains the queue at the start of each
+ *    tick.  There is exactly one producer and one consumer so the queue is
+ *    a lock-free ring buffer.
+ ************************************************************************/
+
+#ifndef INPUT_QUEUE_H
+#define INPUT_QUEUE_H
+
+#include <atomic>
+
+#define INPUT_QUEUE_SIZE 256   // must be a power of two
+
+/*********************************************
+ * INPUT EVENT
+ * One key going down or coming up
+ *********************************************/
+struct InputEvent
+{
+   int       key;         // GLUT_KEY_ code or ascii character
+   bool      fDown;       // pressed or released
+   long long timestamp;   // monotonicNow() when the callback fired
+};
+
+/*********************************************
+ * INPUT QUEUE
+ * Single-producer single-consumer ring of events
+ *********************************************/
+class InputQueue
+{
+public:
+   InputQueue() : head(0), tail(0), dropped(0) {}
+
+   // producer: add an event. Returns false if the queue was full
+   bool push(const InputEvent & event);
+
+   // consumer: look at the oldest event without removing it
+   bool peek(InputEvent & event) const;
+
+   // consumer: remove the oldest event
+   void pop();
+
+   // how many events we had to throw away because we were full
+   unsigned int getDropped() const { return dropped.load(); }
+
+private:
+   InputEvent events[INPUT_QUEUE_SIZE];
+   std::atomic<unsigned int> head;     // next slot the producer writes
+   std::atomic<unsigned int> tail;     // next slot the consumer reads
+   std::atomic<unsigned int> dropped;  // events lost to a full queue
+};
+
+#endif // INPUT_QUEUE_H
@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Source File:
+ *    Level Of Detail : how much effort to put into drawing a rock
+ * Summary:
+ *    Pick a shape from the size of the rock on the screen.
+ ************************************************************************/
+
+#include "levelOfDetail.h"
+
+float LevelOfDetail::scale = 1.0;
+int   LevelOfDetail::bias  = 0;
+
+/******************************************************************
+ * LEVEL OF DETAIL : SET BIAS
+ *   INPUT  bias   0 is normal, DETAIL_MAX_BIAS is the coarsest
+ ****************************************************************/
+void LevelOfDetail::setBias(int bias)
+{
+   if (bias < 0)
+      bias = 0;
+   if (bias > DETAIL_MAX_BIAS)
+      bias = DETAIL_MAX_BIAS;
+   LevelOfDetail::bias = bias;
+}
+
+/******************************************************************
+ * LEVEL OF DETAIL : SELECT
+ * Project the radius onto the screen and compare it with the
+ * cutoffs, which double with every step of bias.
+ *   INPUT  radius    size of the rock in world units
+ *   OUTPUT <return>  DETAIL_FULL, DETAIL_OUTLINE or DETAIL_DOT
+ ****************************************************************/
+int LevelOfDetail::select(float radius)
+{
+   float pixels = radius * scale / (float)(1 << bias);
+
+   if (pixels >= DETAIL_FULL_PIXELS)
+      return DETAIL_FULL;
+   if (pixels >= DETAIL_OUTLINE_PIXELS)
+      return DETAIL_OUTLINE;
+   return DETAIL_DOT;
+}
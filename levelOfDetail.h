@@ -0,0 +1,49 @@
+/***********************************************************************
+ * Header File:
+ *    Level Of Detail : how much effort to put into drawing a rock
+ * Summary:
+ *    A rock that covers a handful of pixels does not need every vertex
+ *    and a fresh random color on each one.  The detail is picked from
+ *    how big the rock will be on the screen.  When frames run over their
+ *    budget the quality governor raises the cutoffs so simpler shapes
+ *    are used sooner.
+ ************************************************************************/
+
+#ifndef LEVEL_OF_DETAIL_H
+#define LEVEL_OF_DETAIL_H
+
+#define DETAIL_FULL     0   // every vertex, every color: the classic look
+#define DETAIL_OUTLINE  1   // a few vertices in one color
+#define DETAIL_DOT      2   // a single point
+
+// full detail down to the smallest rock at zoom 1 (SMALL_ROCK_SIZE), so
+// only zooming out or the governor's bias ever makes a rock simpler
+#define DETAIL_FULL_PIXELS    4.0   // radius on screen for full detail
+#define DETAIL_OUTLINE_PIXELS 1.0   // radius on screen for an outline
+#define DETAIL_MAX_BIAS       3     // most we will coarsen under load
+
+/*********************************************
+ * LEVEL OF DETAIL
+ * Global: every rock in a frame follows the
+ * same rules.
+ *********************************************/
+class LevelOfDetail
+{
+public:
+   // how many pixels one world unit covers this frame
+   static void  setScale(float pixelsPerUnit) { scale = pixelsPerUnit; }
+   static float getScale()                    { return scale;          }
+
+   // each step of bias doubles the size needed for the finer detail
+   static void setBias(int bias);
+   static int  getBias() { return bias; }
+
+   // which detail should a rock of this radius be drawn with?
+   static int select(float radius);
+
+private:
+   static float scale;        // pixels per world unit
+   static int   bias;         // how much coarser than normal
+};
+
+#endif // LEVEL_OF_DETAIL_H
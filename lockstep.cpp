@@ -0,0 +1,549 @@
+/***********************************************************************
+ * Source File:
+ *    Lockstep : two games on two machines playing as one
+ * Summary:
+ *    Packets are laid out byte by byte, most significant first, so the
+ *    two sides need not be the same kind of machine:
+ *
+ *       HELLO  magic(4) type(1) side(1) heard(1) delay(1)
+ *              seed(4) settings(4)
+ *       INPUT  magic(4) type(1) side(1) ack(4) hashTick(4) hash(8)
+ *              first(4) count(1) keys(count)
+ *
+ *    ack is the newest tick up to which the sender has all of our keys.
+ *    The keys run from tick first on.  A tick of -1 means none yet.
+ *
+ *    Both sides know the first delay ticks are empty, so those never
+ *    travel.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for memset() and strchr()
+#include <cstdio>     // for snprintf()
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET Socket;
+#define closeSocket closesocket
+#define pollSocket  WSAPoll
+typedef WSAPOLLFD PollFd;
+#else
+#include <unistd.h>       // for close()
+#include <poll.h>
+#include <netdb.h>        // for getaddrinfo()
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+typedef int Socket;
+#define INVALID_SOCKET -1
+#define closeSocket close
+#define pollSocket  poll
+typedef pollfd PollFd;
+#endif // _WIN32
+
+#include "lockstep.h"
+#include "frameTimer.h"   // for monotonicNow()
+
+using namespace std;
+
+#define LOCKSTEP_MAGIC      0x41535453   // "ASTS"
+#define LOCKSTEP_HELLO      1
+#define LOCKSTEP_INPUT      2
+#define LOCKSTEP_HELLO_SIZE 16
+#define LOCKSTEP_INPUT_HEAD 27           // an INPUT before its keys
+#define LOCKSTEP_PACKET_MAX 256          // the biggest INPUT is 155 bytes
+#define LOCKSTEP_FLUSH_MS   1000         // how long stop() tries
+
+bool   Lockstep::active = false;
+bool   Lockstep::failed = false;
+string Lockstep::error;
+int    Lockstep::side   = 0;
+int    Lockstep::tick   = 0;
+int    Lockstep::stalls = 0;
+
+static Socket        sock = INVALID_SOCKET;
+static sockaddr_in   peerAddress;
+static int           delay;
+static unsigned char localKeys[LOCKSTEP_WINDOW];   // by tick % LOCKSTEP_WINDOW
+static unsigned char remoteKeys[LOCKSTEP_WINDOW];
+static int           localNewest;    // newest tick we have our keys for
+static int           remoteNewest;   // ... and all the peer's, without a gap
+static int           peerAck;        // newest the peer says it has of ours
+static int           hashTicks[LOCKSTEP_WINDOW];   // which tick each hash is
+static unsigned long long hashes[LOCKSTEP_WINDOW];
+static int           peerHashTicks[LOCKSTEP_WINDOW];
+static unsigned long long peerHashes[LOCKSTEP_WINDOW];
+static int           lastHashTick;   // newest tick we have a hash for
+static long long     lastHeard;      // when the peer last said anything
+static long long     lastSent;
+
+/******************************************************************
+ * PUT / GET
+ * Write and read a big-endian number of the given size
+ ****************************************************************/
+static void put(unsigned char * buffer, int & pos, unsigned long long value,
+                int bytes)
+{
+   for (int i = bytes - 1; i >= 0; i--)
+      buffer[pos++] = (unsigned char)(value >> (8 * i));
+}
+
+static unsigned long long get(const unsigned char * buffer, int & pos,
+                              int bytes)
+{
+   unsigned long long value = 0;
+   for (int i = 0; i < bytes; i++)
+      value = (value << 8) | buffer[pos++];
+   return value;
+}
+
+/******************************************************************
+ * WAIT FOR PACKET
+ * Is there something to read within waitMs?
+ ****************************************************************/
+static bool waitForPacket(int waitMs)
+{
+   PollFd waiting = { sock, POLLIN, 0 };
+   return pollSocket(&waiting, 1, waitMs) > 0;
+}
+
+/******************************************************************
+ * RECEIVE PACKET
+ * The next packet from the peer, ignoring anyone else.  Returns
+ * the size, or 0 if nothing is waiting
+ ****************************************************************/
+static int receivePacket(unsigned char * buffer)
+{
+   while (waitForPacket(0))
+   {
+      sockaddr_in from;
+      socklen_t fromSize = sizeof(from);
+      int size = (int)recvfrom(sock, (char *)buffer, LOCKSTEP_PACKET_MAX, 0,
+                               (sockaddr *)&from, &fromSize);
+      if (size < 6 ||
+          from.sin_addr.s_addr != peerAddress.sin_addr.s_addr ||
+          from.sin_port != peerAddress.sin_port)
+         continue;
+      int pos = 0;
+      if (get(buffer, pos, 4) != LOCKSTEP_MAGIC)
+         continue;
+      return size;
+   }
+   return 0;
+}
+
+/******************************************************************
+ * SEND PACKET
+ ****************************************************************/
+static void sendPacket(const unsigned char * buffer, int size)
+{
+   sendto(sock, (const char *)buffer, size, 0,
+          (const sockaddr *)&peerAddress, sizeof(peerAddress));
+   lastSent = monotonicNow();
+}
+
+/******************************************************************
+ * FIND PEER
+ * "host:port" or just "port", which is on this machine
+ ****************************************************************/
+static bool findPeer(const char * peer)
+{
+   string host = "127.0.0.1";
+   string port = peer;
+   const char * colon = strchr(peer, ':');
+   if (colon)
+   {
+      host = string(peer, colon - peer);
+      port = colon + 1;
+   }
+
+   addrinfo hints;
+   memset(&hints, 0, sizeof(hints));
+   hints.ai_family   = AF_INET;
+   hints.ai_socktype = SOCK_DGRAM;
+   addrinfo * found = NULL;
+   if (getaddrinfo(host.c_str(), port.c_str(), &hints, &found) != 0 || !found)
+      return false;
+   memcpy(&peerAddress, found->ai_addr, sizeof(peerAddress));
+   freeaddrinfo(found);
+   return true;
+}
+
+/******************************************************************
+ * LOCKSTEP : CONNECT
+ * Say hello until the peer says hello back and has heard us.
+ * Any INPUT from the peer means it has heard us too.
+ ****************************************************************/
+bool Lockstep::connect(int side, int port, const char * peer, int delay,
+                       unsigned int settings, unsigned int & seed)
+{
+   assert(!active);
+   assert(side == 0 || side == 1);
+   assert(delay >= 0 && delay <= LOCKSTEP_MAX_DELAY);
+
+#ifdef _WIN32
+   WSADATA wsa;
+   if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+   {
+      error = "no sockets";
+      return false;
+   }
+#endif // _WIN32
+
+   if (!findPeer(peer))
+   {
+      error = string("cannot find ") + peer;
+      return false;
+   }
+
+   sock = socket(AF_INET, SOCK_DGRAM, 0);
+   if (sock == INVALID_SOCKET)
+   {
+      error = "no sockets";
+      return false;
+   }
+   sockaddr_in local;
+   memset(&local, 0, sizeof(local));
+   local.sin_family      = AF_INET;
+   local.sin_port        = htons((unsigned short)port);
+   local.sin_addr.s_addr = htonl(INADDR_ANY);
+   if (::bind(sock, (sockaddr *)&local, sizeof(local)) != 0)
+   {
+      closeSocket(sock);
+      error = "cannot listen on port " + to_string(port);
+      return false;
+   }
+
+   Lockstep::side = side;
+   ::delay        = delay;
+   failed         = false;
+   error.clear();
+
+   bool heard   = false;   // we have the peer's hello
+   bool answered = false;  // the peer has ours
+   long long deadline = monotonicNow() + LOCKSTEP_CONNECT_MS * 1000000LL;
+   unsigned char buffer[LOCKSTEP_PACKET_MAX];
+   while (!(heard && answered))
+   {
+      if (monotonicNow() > deadline)
+      {
+         closeSocket(sock);
+         error = string("no answer from ") + peer;
+         return false;
+      }
+
+      int pos = 0;
+      put(buffer, pos, LOCKSTEP_MAGIC, 4);
+      put(buffer, pos, LOCKSTEP_HELLO, 1);
+      put(buffer, pos, side, 1);
+      put(buffer, pos, heard, 1);
+      put(buffer, pos, delay, 1);
+      put(buffer, pos, seed, 4);
+      put(buffer, pos, settings, 4);
+      sendPacket(buffer, pos);
+
+      waitForPacket(LOCKSTEP_RESEND_MS * 5);
+      int size;
+      while ((size = receivePacket(buffer)) > 0)
+      {
+         pos = 4;
+         int type     = (int)get(buffer, pos, 1);
+         int peerSide = (int)get(buffer, pos, 1);
+         if (peerSide != 1 - side)
+            continue;
+         if (type == LOCKSTEP_INPUT)
+         {
+            answered = heard;
+            continue;
+         }
+         if (type != LOCKSTEP_HELLO || size < LOCKSTEP_HELLO_SIZE)
+            continue;
+
+         bool peerHeard        = get(buffer, pos, 1) != 0;
+         int peerDelay         = (int)get(buffer, pos, 1);
+         unsigned int peerSeed = (unsigned int)get(buffer, pos, 4);
+         if (peerDelay != delay || (unsigned int)get(buffer, pos, 4) != settings)
+         {
+            closeSocket(sock);
+            error = "the peer is playing a different game";
+            return false;
+         }
+         if (side == 1)
+            seed = peerSeed;
+         heard    = true;
+         answered = answered || peerHeard;
+      }
+   }
+
+   // the peer may have said hello without hearing our answer
+   int pos = 0;
+   put(buffer, pos, LOCKSTEP_MAGIC, 4);
+   put(buffer, pos, LOCKSTEP_HELLO, 1);
+   put(buffer, pos, side, 1);
+   put(buffer, pos, 1, 1);
+   put(buffer, pos, delay, 1);
+   put(buffer, pos, seed, 4);
+   put(buffer, pos, settings, 4);
+   sendPacket(buffer, pos);
+
+   // both sides know the first delay ticks are empty
+   memset(localKeys,  0, sizeof(localKeys));
+   memset(remoteKeys, 0, sizeof(remoteKeys));
+   for (int i = 0; i < LOCKSTEP_WINDOW; i++)
+      hashTicks[i] = peerHashTicks[i] = -1;
+   localNewest  = delay - 1;
+   remoteNewest = delay - 1;
+   peerAck      = delay - 1;
+   lastHashTick = -1;
+   tick         = 0;
+   stalls       = 0;
+   lastHeard    = monotonicNow();
+   active       = true;
+   return true;
+}
+
+/******************************************************************
+ * CHECK HASHES
+ * If both sides have a hash for this tick, they had better agree
+ ****************************************************************/
+static void checkHashes(int hashTick)
+{
+   int slot = hashTick % LOCKSTEP_WINDOW;
+   if (hashTicks[slot] != hashTick || peerHashTicks[slot] != hashTick ||
+       hashes[slot] == peerHashes[slot] || Lockstep::isFailed())
+      return;
+
+   char text[128];
+   snprintf(text, sizeof(text), "out of step at tick %d: ours %016llx, theirs %016llx",
+            hashTick, hashes[slot], peerHashes[slot]);
+   Lockstep::fail(text);
+}
+
+/******************************************************************
+ * SEND INPUT
+ * Every key the peer has not acknowledged, and our latest hash
+ ****************************************************************/
+static void sendInput(int side)
+{
+   unsigned char buffer[LOCKSTEP_PACKET_MAX];
+   int first = peerAck + 1;
+   int count = localNewest - peerAck;
+   assert(count >= 0 && count <= LOCKSTEP_WINDOW);
+
+   int pos = 0;
+   put(buffer, pos, LOCKSTEP_MAGIC, 4);
+   put(buffer, pos, LOCKSTEP_INPUT, 1);
+   put(buffer, pos, side, 1);
+   put(buffer, pos, (unsigned int)remoteNewest, 4);
+   put(buffer, pos, (unsigned int)lastHashTick, 4);
+   put(buffer, pos, lastHashTick >= 0 ?
+                    hashes[lastHashTick % LOCKSTEP_WINDOW] : 0, 8);
+   put(buffer, pos, (unsigned int)first, 4);
+   put(buffer, pos, count, 1);
+   for (int t = first; t <= localNewest; t++)
+      put(buffer, pos, localKeys[t % LOCKSTEP_WINDOW], 1);
+   sendPacket(buffer, pos);
+}
+
+/******************************************************************
+ * RECEIVE INPUT
+ * Take in everything the peer has sent.  Keys are only kept in
+ * order; anything past a gap will come again.
+ ****************************************************************/
+static void receiveInput(int side)
+{
+   unsigned char buffer[LOCKSTEP_PACKET_MAX];
+   int size;
+   while ((size = receivePacket(buffer)) > 0)
+   {
+      int pos = 4;
+      int type     = (int)get(buffer, pos, 1);
+      int peerSide = (int)get(buffer, pos, 1);
+      if (type != LOCKSTEP_INPUT || peerSide != 1 - side || size < LOCKSTEP_INPUT_HEAD)
+         continue;
+      lastHeard = monotonicNow();
+
+      int ack      = (int)get(buffer, pos, 4);
+      int hashTick = (int)get(buffer, pos, 4);
+      unsigned long long hash = get(buffer, pos, 8);
+      int first    = (int)get(buffer, pos, 4);
+      int count    = (int)get(buffer, pos, 1);
+      if (size < pos + count)
+         continue;
+
+      if (ack > peerAck && ack <= localNewest)
+         peerAck = ack;
+
+      if (hashTick >= 0)
+      {
+         peerHashTicks[hashTick % LOCKSTEP_WINDOW] = hashTick;
+         peerHashes[hashTick % LOCKSTEP_WINDOW]    = hash;
+         checkHashes(hashTick);
+      }
+
+      for (int i = 0; i < count; i++)
+      {
+         int t = first + i;
+         unsigned char keys = (unsigned char)get(buffer, pos, 1);
+         if (t != remoteNewest + 1 || t - Lockstep::getTick() >= LOCKSTEP_WINDOW)
+            continue;
+         remoteKeys[t % LOCKSTEP_WINDOW] = keys;
+         remoteNewest = t;
+      }
+   }
+}
+
+/******************************************************************
+ * LOCKSTEP : STEP
+ ****************************************************************/
+bool Lockstep::step(int keys, int playerKeys[LOCKSTEP_PLAYERS], int waitMs)
+{
+   assert(active);
+   if (failed)
+      return false;
+
+   // our keys for this tick are played delay ticks from now
+   if (localNewest < tick + ::delay)
+   {
+      localNewest++;
+      localKeys[localNewest % LOCKSTEP_WINDOW] = (unsigned char)keys;
+      sendInput(side);
+   }
+   receiveInput(side);
+
+   long long start = monotonicNow();
+   while (remoteNewest < tick && !failed)
+   {
+      long long now = monotonicNow();
+      if (now - lastHeard > LOCKSTEP_TIMEOUT_MS * 1000000LL)
+      {
+         fail("the peer stopped answering");
+         return false;
+      }
+      if (now - lastSent >= LOCKSTEP_RESEND_MS * 1000000LL)
+         sendInput(side);
+
+      long long left = waitMs - (now - start) / 1000000LL;
+      if (left <= 0)
+         break;
+      waitForPacket((int)(left < LOCKSTEP_RESEND_MS ? left : LOCKSTEP_RESEND_MS));
+      receiveInput(side);
+   }
+   if (failed)
+      return false;
+   if (remoteNewest < tick)
+   {
+      stalls++;
+      return false;
+   }
+
+   playerKeys[side]     = localKeys[tick % LOCKSTEP_WINDOW];
+   playerKeys[1 - side] = remoteKeys[tick % LOCKSTEP_WINDOW];
+   tick++;
+   return true;
+}
+
+/******************************************************************
+ * LOCKSTEP : PREDICT
+ ****************************************************************/
+bool Lockstep::predict(int keys, int playerKeys[LOCKSTEP_PLAYERS])
+{
+   assert(active);
+   if (localNewest < tick + ::delay)
+   {
+      localNewest++;
+      localKeys[localNewest % LOCKSTEP_WINDOW] = (unsigned char)keys;
+      sendInput(side);
+   }
+   poll();
+
+   bool known = remoteNewest >= tick;
+   playerKeys[side]     = localKeys[tick % LOCKSTEP_WINDOW];
+   playerKeys[1 - side] = known ? remoteKeys[tick % LOCKSTEP_WINDOW] :
+                                  getRemoteKeys(remoteNewest);
+   tick++;
+   return known;
+}
+
+/******************************************************************
+ * LOCKSTEP : POLL
+ ****************************************************************/
+void Lockstep::poll()
+{
+   assert(active);
+   receiveInput(side);
+   long long now = monotonicNow();
+   if (now - lastHeard > LOCKSTEP_TIMEOUT_MS * 1000000LL)
+      fail("the peer stopped answering");
+   else if (now - lastSent >= LOCKSTEP_RESEND_MS * 1000000LL)
+      sendInput(side);
+}
+
+/******************************************************************
+ * LOCKSTEP : GET CONFIRMED / GET LOCAL KEYS / GET REMOTE KEYS
+ ****************************************************************/
+int Lockstep::getConfirmed()
+{
+   return remoteNewest;
+}
+
+int Lockstep::getLocalKeys(int keyTick)
+{
+   assert(keyTick <= localNewest && localNewest - keyTick < LOCKSTEP_WINDOW);
+   return keyTick < 0 ? 0 : localKeys[keyTick % LOCKSTEP_WINDOW];
+}
+
+int Lockstep::getRemoteKeys(int keyTick)
+{
+   assert(keyTick <= remoteNewest && remoteNewest - keyTick < LOCKSTEP_WINDOW);
+   return keyTick < 0 ? 0 : remoteKeys[keyTick % LOCKSTEP_WINDOW];
+}
+
+/******************************************************************
+ * LOCKSTEP : CONFIRM
+ ****************************************************************/
+void Lockstep::confirm(int hashTick, unsigned long long hash)
+{
+   assert(active && hashTick >= 0 && hashTick < tick);
+   lastHashTick = hashTick;
+   hashTicks[hashTick % LOCKSTEP_WINDOW] = hashTick;
+   hashes[hashTick % LOCKSTEP_WINDOW]    = hash;
+   checkHashes(hashTick);
+}
+
+/******************************************************************
+ * LOCKSTEP : FAIL
+ ****************************************************************/
+void Lockstep::fail(const string & reason)
+{
+   failed = true;
+   error  = reason;
+}
+
+/******************************************************************
+ * LOCKSTEP : STOP
+ * The peer may still need the keys for the ticks we played last,
+ * so keep sending until it says it has them, for a little while
+ ****************************************************************/
+void Lockstep::stop()
+{
+   if (!active)
+      return;
+   active = false;
+
+   long long deadline = monotonicNow() + LOCKSTEP_FLUSH_MS * 1000000LL;
+   while (!failed && peerAck < tick - 1 && monotonicNow() < deadline)
+   {
+      sendInput(side);
+      waitForPacket(LOCKSTEP_RESEND_MS);
+      receiveInput(side);
+   }
+   sendInput(side);
+
+   closeSocket(sock);
+#ifdef _WIN32
+   WSACleanup();
+#endif // _WIN32
+}
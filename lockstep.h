@@ -0,0 +1,106 @@
+/***********************************************************************
+ * Header File:
+ *    Lockstep : two games on two machines playing as one
+ * Summary:
+ *    Nothing about the rocks or the bullets ever crosses the wire.  Both
+ *    sides run the whole simulation, seeded alike, and all they trade
+ *    is which keys each player held on each tick: one byte a tick, no
+ *    matter how much is flying around.  Since the simulation only
+ *    depends on the seed and the keys, both sides stay in step.
+ *
+ *    A key pressed on tick t is played on tick t + delay, which gives
+ *    it time to reach the other side before it is needed.  If it is
+ *    late anyway the game waits for it.  Every packet repeats all the
+ *    keys the other side has not acknowledged, so a lost packet costs
+ *    nothing but a little wait.
+ *
+ *    With rollback, a tick does not wait for the peer's keys: the peer
+ *    is guessed to hold what it held last, and when its real keys turn
+ *    out different the game goes back and plays those ticks again (see
+ *    rollback.h).  Both kinds of peer can play each other.
+ *
+ *    Each side also sends the state hash after its latest tick.  If the
+ *    two ever differ for the same tick, the games have drifted apart
+ *    and we stop and say where, rather than play on in two different
+ *    worlds.
+ *
+ *    Side 0 picks the seed; side 1 takes it.  Both must agree on the
+ *    settings that shape the game, or the handshake fails.
+ ************************************************************************/
+
+#ifndef LOCKSTEP_H
+#define LOCKSTEP_H
+
+#include <string>
+
+#define LOCKSTEP_PLAYERS        2      // one on each side
+#define LOCKSTEP_DEFAULT_DELAY  3      // ticks between a key and its tick
+#define LOCKSTEP_MAX_DELAY      16
+#define LOCKSTEP_WINDOW         128    // ticks of keys and hashes remembered
+#define LOCKSTEP_CONNECT_MS     30000  // how long to look for the peer
+#define LOCKSTEP_TIMEOUT_MS     10000  // give up on a peer this quiet
+#define LOCKSTEP_RESEND_MS      20     // repeat ourselves this often
+
+/*********************************************
+ * LOCKSTEP
+ * There is one session, so everything is
+ * static.  Only the game thread calls in.
+ *********************************************/
+class Lockstep
+{
+public:
+   // listen on a UDP port and find the peer at "host:port", or just
+   // "port" on this machine.  Side 0 sends its seed; side 1 gets it
+   // back in seed.  The settings must match on both sides.  Returns
+   // false, with a reason in getError(), if there was nobody there
+   static bool connect(int side, int port, const char * peer, int delay,
+                       unsigned int settings, unsigned int & seed);
+
+   // make sure the peer has our last keys, then hang up
+   static void stop();
+
+   static bool isActive()  { return active;  }
+   static bool isFailed()  { return failed;  }
+   static const std::string & getError() { return error; }
+   static int  getSide()   { return side;    }
+   static int  getTick()   { return tick;    }
+   static int  getStalls() { return stalls;  }
+
+   // hand over the local keys for this tick and get every player's keys
+   // for the next tick to play.  Waits up to waitMs for the peer.
+   // Returns false if its keys are not here yet; call again with the
+   // same keys.  Only the first call for a tick records them
+   static bool step(int keys, int playerKeys[LOCKSTEP_PLAYERS], int waitMs);
+
+   // for rollback: hand over the local keys for this tick and get every
+   // player's keys for the next tick without waiting.  If the peer's
+   // keys are not here yet, its newest keys stand in for them.
+   // Returns false if they were a guess
+   static bool predict(int keys, int playerKeys[LOCKSTEP_PLAYERS]);
+
+   // read what has arrived, and say it again if the peer is quiet
+   static void poll();
+
+   // every tick up to this one has the peer's real keys
+   static int getConfirmed();
+
+   // the keys each side played on a recent tick
+   static int getLocalKeys(int tick);
+   static int getRemoteKeys(int tick);
+
+   // the state hash after a tick, once it can no longer change
+   static void confirm(int tick, unsigned long long hash);
+
+   // end the session, saying why
+   static void fail(const std::string & reason);
+
+private:
+   static bool        active;
+   static bool        failed;
+   static std::string error;
+   static int         side;
+   static int         tick;     // the next tick to play
+   static int         stalls;   // calls to step() that had to wait
+};
+
+#endif // LOCKSTEP_H
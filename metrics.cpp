@@ -0,0 +1,363 @@
+/***********************************************************************
+ * Source File:
+ *    Metrics : frame and entity counters for anyone watching
+ * Summary:
+ *    The counters are relaxed atomics: each one is right on its own,
+ *    and a scrape may mix values from two neighbouring frames, which
+ *    nobody watching a graph will notice.  The server handles one
+ *    connection at a time, waking every so often to read the event bus
+ *    and to see whether it has been told to stop.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for strlen() and strncmp()
+#include <cstdlib>    // for atoi()
+#include <atomic>
+#include <thread>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET Socket;
+#define closeSocket closesocket
+#else
+#include <unistd.h>       // for close() and unlink()
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>     // for lstat()
+#include <sys/time.h>     // for timeval
+#include <sys/un.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+typedef int Socket;
+#define INVALID_SOCKET -1
+#define closeSocket close
+#endif // _WIN32
+
+#include "metrics.h"
+#include "eventBus.h"
+
+using namespace std;
+
+#define METRICS_POLL_MS       100    // how often the server looks around
+#define METRICS_REQUEST_MAX   1024   // we only need the first line
+#define METRICS_CLIENT_MS     1000   // the longest a scraper may keep us
+
+/*********************************************
+ * METRIC INFO
+ * What Prometheus is told about each metric
+ *********************************************/
+struct MetricInfo
+{
+   const char * name;
+   const char * type;   // "gauge" or "counter"
+   const char * help;
+};
+
+static const MetricInfo info[METRIC_COUNT] =
+{
+   { "asteroids_frame_time_ns",       "gauge",   "Time between frames, a moving average over about eight" },
+   { "asteroids_work_time_ns",        "gauge",   "Time the last frame's work took: input, the tick and drawing" },
+   { "asteroids_frames_total",        "counter", "Frames drawn since the start" },
+   { "asteroids_rocks",               "gauge",   "Rocks alive" },
+   { "asteroids_bullets",             "gauge",   "Bullets in flight" },
+   { "asteroids_debris",              "gauge",   "Debris particles alive" },
+   { "asteroids_stars",               "gauge",   "Background stars" },
+   { "asteroids_trail",               "gauge",   "Particles in the ship's trail" },
+   { "asteroids_allocations",         "gauge",   "Heap allocations in the last frame" },
+   { "asteroids_collision_tests",     "gauge",   "Object pairs tested for collision in the last frame" },
+   { "asteroids_collision_hits",      "gauge",   "Tested pairs that were touching" },
+   { "asteroids_quality_level",       "gauge",   "Quality governor level, 0 is best" },
+   { "asteroids_score",               "gauge",   "The player's score" },
+   { "asteroids_tick_time_ns",        "gauge",   "Time the last tick of the simulation took" },
+   { "asteroids_input_to_simulation_p50_ns", "gauge", "Median time from a key event to the tick that saw it" },
+   { "asteroids_input_to_simulation_p99_ns", "gauge", "99th percentile time from a key event to the tick that saw it" },
+   { "asteroids_input_to_photon_p50_ns",     "gauge", "Median time from a key event to the swap that showed it" },
+   { "asteroids_input_to_photon_p99_ns",     "gauge", "99th percentile time from a key event to the swap that showed it" },
+};
+
+static atomic<long long>  values[METRIC_COUNT];
+static atomic<long long>  events[EVENT_TYPE_COUNT];   // counted by the server
+static atomic<bool>       running(false);
+static thread             server;
+static Socket             listener = INVALID_SOCKET;
+static string             socketPath;                 // to unlink at the end
+
+bool   Metrics::serving = false;
+string Metrics::error;
+
+/******************************************************************
+ * METRICS : SET
+ ****************************************************************/
+void Metrics::set(int metric, long long value)
+{
+   assert(metric >= 0 && metric < METRIC_COUNT);
+   values[metric].store(value, memory_order_relaxed);
+}
+
+/******************************************************************
+ * METRICS : GET
+ ****************************************************************/
+long long Metrics::get(int metric)
+{
+   assert(metric >= 0 && metric < METRIC_COUNT);
+   return values[metric].load(memory_order_relaxed);
+}
+
+/******************************************************************
+ * METRICS : WRITE
+ * The Prometheus text exposition format, version 0.0.4
+ *   OUTPUT out   every metric, with its help and type lines
+ ****************************************************************/
+void Metrics::write(string & out)
+{
+   for (int i = 0; i < METRIC_COUNT; i++)
+   {
+      out += "# HELP ";
+      out += info[i].name;
+      out += ' ';
+      out += info[i].help;
+      out += "\n# TYPE ";
+      out += info[i].name;
+      out += ' ';
+      out += info[i].type;
+      out += '\n';
+      out += info[i].name;
+      out += ' ';
+      out += to_string(get(i));
+      out += '\n';
+   }
+
+   out += "# HELP asteroids_events_total Game events published\n"
+          "# TYPE asteroids_events_total counter\n";
+   for (int type = 0; type < EVENT_TYPE_COUNT; type++)
+   {
+      out += "asteroids_events_total{type=\"";
+      out += EventBus::typeName(type);
+      out += "\"} ";
+      out += to_string(events[type].load(memory_order_relaxed));
+      out += '\n';
+   }
+}
+
+/******************************************************************
+ * SET TIMEOUTS
+ * There is one server thread, so a client that connects and says
+ * nothing must not hold it, or Metrics::stop(), for long
+ ****************************************************************/
+static void setTimeouts(Socket client)
+{
+#ifdef _WIN32
+   DWORD limit = METRICS_CLIENT_MS;
+#else
+   timeval limit;
+   limit.tv_sec  = METRICS_CLIENT_MS / 1000;
+   limit.tv_usec = METRICS_CLIENT_MS % 1000 * 1000;
+#endif // _WIN32
+   setsockopt(client, SOL_SOCKET, SO_RCVTIMEO, (const char *)&limit,
+              sizeof(limit));
+   setsockopt(client, SOL_SOCKET, SO_SNDTIMEO, (const char *)&limit,
+              sizeof(limit));
+}
+
+/******************************************************************
+ * ANSWER
+ * Read the request line and send back the metrics, or a 404 for
+ * anything but a GET of / or /metrics
+ ****************************************************************/
+static void answer(Socket client)
+{
+   char request[METRICS_REQUEST_MAX + 1];
+   int length = (int)recv(client, request, METRICS_REQUEST_MAX, 0);
+   if (length <= 0)
+      return;
+   request[length] = '\0';
+
+   string body;
+   string reply;
+   if (strncmp(request, "GET /metrics ", 13) == 0 ||
+       strncmp(request, "GET / ", 6) == 0)
+   {
+      Metrics::write(body);
+      reply = "HTTP/1.0 200 OK\r\n"
+              "Content-Type: text/plain; version=0.0.4\r\n";
+   }
+   else
+   {
+      body = "not found\n";
+      reply = "HTTP/1.0 404 Not Found\r\n"
+              "Content-Type: text/plain\r\n";
+   }
+   reply += "Content-Length: " + to_string(body.size()) + "\r\n"
+            "Connection: close\r\n\r\n" + body;
+
+   const char * p = reply.c_str();
+   size_t left = reply.size();
+   while (left > 0)
+   {
+      int sent = (int)send(client, p, (int)left, 0);
+      if (sent <= 0)
+         return;
+      p += sent;
+      left -= sent;
+   }
+}
+
+/******************************************************************
+ * SERVER
+ * Count events, answer whoever knocks, and quit when stopped
+ ****************************************************************/
+static void serverMain()
+{
+   EventSubscriber subscriber;
+   GameEvent event;
+
+   while (running.load())
+   {
+      while (subscriber.poll(event))
+         events[event.type].fetch_add(1, memory_order_relaxed);
+
+#ifdef _WIN32
+      WSAPOLLFD waiting = { listener, POLLIN, 0 };
+      if (WSAPoll(&waiting, 1, METRICS_POLL_MS) <= 0)
+         continue;
+#else
+      pollfd waiting = { listener, POLLIN, 0 };
+      if (poll(&waiting, 1, METRICS_POLL_MS) <= 0)
+         continue;
+#endif // _WIN32
+
+      Socket client = accept(listener, NULL, NULL);
+      if (client == INVALID_SOCKET)
+         continue;
+      setTimeouts(client);
+      answer(client);
+      closeSocket(client);
+   }
+}
+
+/******************************************************************
+ * METRICS : SERVE
+ *   INPUT  address   a port on 127.0.0.1, or a Unix socket path
+ *   OUTPUT <return>  false if we could not listen
+ ****************************************************************/
+bool Metrics::serve(const char * address)
+{
+   assert(!serving);
+   error.clear();
+   bool isPort = address[0] != '\0' &&
+                 strspn(address, "0123456789") == strlen(address);
+
+#ifdef _WIN32
+   WSADATA wsa;
+   if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+   {
+      error = "no sockets";
+      return false;
+   }
+   if (!isPort)
+   {
+      error = "only ports can be served on Windows";
+      return false;
+   }
+#endif // _WIN32
+
+   if (isPort)
+   {
+      listener = socket(AF_INET, SOCK_STREAM, 0);
+      if (listener == INVALID_SOCKET)
+      {
+         error = "no sockets";
+         return false;
+      }
+      int yes = 1;
+      setsockopt(listener, SOL_SOCKET, SO_REUSEADDR,
+                 (const char *)&yes, sizeof(yes));
+
+      sockaddr_in local;
+      memset(&local, 0, sizeof(local));
+      local.sin_family      = AF_INET;
+      local.sin_port        = htons((unsigned short)atoi(address));
+      local.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+      if (::bind(listener, (sockaddr *)&local, sizeof(local)) != 0)
+      {
+         error = string("cannot listen on port ") + address;
+         closeSocket(listener);
+         return false;
+      }
+   }
+#ifndef _WIN32
+   else
+   {
+      sockaddr_un local;
+      memset(&local, 0, sizeof(local));
+      if (strlen(address) >= sizeof(local.sun_path))
+      {
+         error = string(address) + " is too long for a socket";
+         return false;
+      }
+
+      // a socket left from a run that died can go, but nothing else
+      struct stat status;
+      if (lstat(address, &status) == 0)
+      {
+         if (!S_ISSOCK(status.st_mode))
+         {
+            error = string(address) + " is already there and is not a socket";
+            return false;
+         }
+         unlink(address);
+      }
+
+      listener = socket(AF_UNIX, SOCK_STREAM, 0);
+      if (listener == INVALID_SOCKET)
+      {
+         error = "no sockets";
+         return false;
+      }
+      local.sun_family = AF_UNIX;
+      strcpy(local.sun_path, address);
+      if (::bind(listener, (sockaddr *)&local, sizeof(local)) != 0)
+      {
+         error = string("cannot listen on ") + address;
+         closeSocket(listener);
+         return false;
+      }
+      socketPath = address;
+   }
+#endif // _WIN32
+
+   if (listen(listener, 4) != 0)
+   {
+      error = string("cannot listen on ") + address;
+      closeSocket(listener);
+      return false;
+   }
+
+   running = true;
+   server = thread(serverMain);
+   serving = true;
+   return true;
+}
+
+/******************************************************************
+ * METRICS : STOP
+ ****************************************************************/
+void Metrics::stop()
+{
+   if (!serving)
+      return;
+   serving = false;
+
+   running = false;
+   server.join();
+   closeSocket(listener);
+#ifndef _WIN32
+   if (!socketPath.empty())
+      unlink(socketPath.c_str());
+   socketPath.clear();
+#else
+   WSACleanup();
+#endif // _WIN32
+}
@@ -0,0 +1,76 @@
+/***********************************************************************
+ * Header File:
+ *    Metrics : frame and entity counters for anyone watching
+ * Summary:
+ *    The game drops its numbers here once a frame: how long the frame
+ *    and the tick took, how many of everything there is, how many
+ *    allocations and collision tests it cost.  A small HTTP server on
+ *    its own thread hands them out in the Prometheus text format, so a
+ *    running game can be watched with curl or a scraper instead of a
+ *    debugger.  It also subscribes to the event bus and counts events
+ *    by type.
+ *
+ *    The server only ever listens on the local machine: 127.0.0.1 or,
+ *    where there are such things, a Unix socket.
+ ************************************************************************/
+
+#ifndef METRICS_H
+#define METRICS_H
+
+#include <string>
+
+#define METRIC_FRAME_TIME       0   // nanoseconds between frames, smoothed
+#define METRIC_WORK_TIME        1   // nanoseconds the last frame's work took
+#define METRIC_FRAMES           2   // frames since the start
+#define METRIC_ROCKS            3   // entities alive, one list each
+#define METRIC_BULLETS          4
+#define METRIC_DEBRIS           5
+#define METRIC_STARS            6
+#define METRIC_TRAIL            7
+#define METRIC_ALLOCATIONS      8   // allocations in the last frame
+#define METRIC_COLLISION_TESTS  9   // pairs tested in the last frame
+#define METRIC_COLLISION_HITS  10   // of those, how many touched
+#define METRIC_QUALITY         11   // the quality governor's level
+#define METRIC_SCORE           12
+#define METRIC_TICK_TIME       13   // nanoseconds the last tick took
+#define METRIC_INPUT_SIM_P50   14   // nanoseconds from a key to the tick
+#define METRIC_INPUT_SIM_P99   15   //    that saw it
+#define METRIC_INPUT_PHOTON_P50 16  // and to the screen showing it
+#define METRIC_INPUT_PHOTON_P99 17
+#define METRIC_COUNT           18
+
+/*********************************************
+ * METRICS
+ * There is one game and one server, so
+ * everything is static.  set() may be called
+ * from the game thread at any time; the server
+ * reads without stopping it.
+ *********************************************/
+class Metrics
+{
+public:
+   // record the latest value of one metric
+   static void set(int metric, long long value);
+   static long long get(int metric);
+
+   // start serving.  The address is a port number, which listens on
+   // 127.0.0.1, or a path for a Unix socket.  A path that is already
+   // something other than a socket is left alone.  Returns false, with
+   // a reason in getError(), if we could not listen there
+   static bool serve(const char * address);
+   static const std::string & getError() { return error; }
+
+   // stop listening and wait for the server thread to finish
+   static void stop();
+
+   static bool isServing() { return serving; }
+
+   // write every metric in the Prometheus text format
+   static void write(std::string & out);
+
+private:
+   static bool        serving;
+   static std::string error;
+};
+
+#endif // METRICS_H
@@ -0,0 +1,180 @@
+/***********************************************************************
+ * Source File:
+ *    Metrics Test : scrape the metrics server the way Prometheus would
+ * Summary:
+ *    Everything stays on this machine: the server listens on a Unix
+ *    socket in a fresh temporary directory and this program is the
+ *    scraper.  It checks what a scrape returns, that anything else is
+ *    a 404, that a client which never says anything cannot hold the
+ *    server up, and that a path which is not a socket is never
+ *    removed to make room for one.  Run it with "make test".
+ ************************************************************************/
+
+#include <iostream>
+#include <string>
+#include <cstdio>     // for remove()
+#include <cstdlib>    // for mkdtemp()
+#include <cstring>    // for memset() and strcpy()
+#include <thread>
+#include <chrono>
+#include <unistd.h>       // for close() and rmdir()
+#include <poll.h>
+#include <sys/socket.h>
+#include <sys/stat.h>     // for stat()
+#include <sys/un.h>
+
+#include "metrics.h"
+#include "eventBus.h"
+#include "frameTimer.h"   // for monotonicNow()
+
+using namespace std;
+
+#define TEST_WAIT_MS  3000   // the longest a scrape may take
+
+static int failures = 0;
+
+/******************************************************************
+ * CHECK
+ * Report one expectation
+ ****************************************************************/
+static void check(bool passed, const string & what)
+{
+   cout << (passed ? "pass  " : "FAIL  ") << what << endl;
+   if (!passed)
+      failures++;
+}
+
+/******************************************************************
+ * CONNECT TO
+ * A client of the server's socket, or -1
+ ****************************************************************/
+static int connectTo(const string & path)
+{
+   int client = socket(AF_UNIX, SOCK_STREAM, 0);
+   if (client < 0)
+      return -1;
+   sockaddr_un server;
+   memset(&server, 0, sizeof(server));
+   server.sun_family = AF_UNIX;
+   strcpy(server.sun_path, path.c_str());
+   if (connect(client, (sockaddr *)&server, sizeof(server)) != 0)
+   {
+      close(client);
+      return -1;
+   }
+   return client;
+}
+
+/******************************************************************
+ * FETCH
+ * Send a request line and read the reply until the server hangs up.
+ * Empty if there was no answer in time
+ ****************************************************************/
+static string fetch(const string & path, const string & target)
+{
+   int client = connectTo(path);
+   if (client < 0)
+      return "";
+   string request = "GET " + target + " HTTP/1.0\r\n\r\n";
+   if (send(client, request.c_str(), request.size(), 0) != (ssize_t)request.size())
+   {
+      close(client);
+      return "";
+   }
+
+   string reply;
+   long long deadline = monotonicNow() + TEST_WAIT_MS * 1000000LL;
+   for (;;)
+   {
+      int left = (int)((deadline - monotonicNow()) / 1000000);
+      pollfd waiting = { client, POLLIN, 0 };
+      if (left <= 0 || poll(&waiting, 1, left) <= 0)
+      {
+         reply.clear();
+         break;
+      }
+      char buffer[1024];
+      ssize_t length = recv(client, buffer, sizeof(buffer), 0);
+      if (length <= 0)
+         break;
+      reply.append(buffer, length);
+   }
+   close(client);
+   return reply;
+}
+
+/******************************************************************
+ * HAS
+ ****************************************************************/
+static bool has(const string & text, const string & part)
+{
+   return text.find(part) != string::npos;
+}
+
+/******************************************************************
+ * MAIN
+ ****************************************************************/
+int main()
+{
+   char directory[] = "/tmp/asteroids-metrics-XXXXXX";
+   if (!mkdtemp(directory))
+   {
+      cout << "FAIL  cannot make a temporary directory" << endl;
+      return 1;
+   }
+   string path  = string(directory) + "/metrics.sock";
+   string notes = string(directory) + "/notes.txt";
+
+   // a file in the way is refused, not deleted
+   FILE * pNotes = fopen(notes.c_str(), "w");
+   fputs("keep me\n", pNotes);
+   fclose(pNotes);
+   bool served = Metrics::serve(notes.c_str());
+   struct stat status;
+   check(!served, "will not serve over a regular file");
+   check(!Metrics::getError().empty(), "says why: " + Metrics::getError());
+   check(stat(notes.c_str(), &status) == 0 && S_ISREG(status.st_mode),
+         "the file is still there");
+   if (served)
+      Metrics::stop();
+   remove(notes.c_str());
+
+   // the real thing
+   check(Metrics::serve(path.c_str()), "serves on " + path);
+   Metrics::set(METRIC_ROCKS, 42);
+   Metrics::set(METRIC_SCORE, 1234);
+   EventBus::publish(EVENT_SHIP_KILLED, Point(0, 0));
+   EventBus::endFrame();
+   this_thread::sleep_for(chrono::milliseconds(300));   // to be counted
+
+   // someone who connects and never asks must not stop the scrape
+   int idle = connectTo(path);
+   check(idle >= 0, "an idle client connects");
+
+   string reply = fetch(path, "/metrics");
+   check(has(reply, "HTTP/1.0 200 OK"), "/metrics is found despite the idle client");
+   check(has(reply, "# TYPE asteroids_rocks gauge\n"), "rocks are a gauge");
+   check(has(reply, "\nasteroids_rocks 42\n"), "rocks are 42");
+   check(has(reply, "\nasteroids_score 1234\n"), "the score is 1234");
+   check(has(reply, "asteroids_events_total{type=\"ship_killed\"} 1\n"),
+         "the ship's death was counted");
+
+   reply = fetch(path, "/");
+   check(has(reply, "\nasteroids_rocks 42\n"), "/ is the metrics too");
+
+   reply = fetch(path, "/nothing-here");
+   check(has(reply, "HTTP/1.0 404 Not Found"), "anything else is a 404");
+   check(!has(reply, "asteroids_rocks"), "and has no metrics in it");
+
+   // stopping must not wait on the idle client
+   long long start = monotonicNow();
+   Metrics::stop();
+   check(monotonicNow() - start < TEST_WAIT_MS * 1000000LL, "stops promptly");
+   if (idle >= 0)
+      close(idle);
+   check(stat(path.c_str(), &status) != 0, "the socket is removed");
+   rmdir(directory);
+
+   cout << (failures == 0 ? "all passed" : "some failed") << endl;
+   return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,482 @@
+/***********************************************************************
+ * Source File:
+ *    Net Client : the game as a server shows it
+ * Summary:
+ *    The packets are the server's; see server.cpp.  A snapshot whose
+ *    baseline we no longer have cannot be read and is dropped.  We do
+ *    not answer it, so the server goes on sending against the last one
+ *    we did answer until a snapshot gets through.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for memset() and strchr()
+#include <string>
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET Socket;
+#define closeSocket closesocket
+#define pollSocket  WSAPoll
+typedef WSAPOLLFD PollFd;
+#else
+#include <unistd.h>       // for close()
+#include <poll.h>
+#include <netdb.h>        // for getaddrinfo()
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+typedef int Socket;
+#define INVALID_SOCKET -1
+#define closeSocket ::close
+#define pollSocket  ::poll
+typedef pollfd PollFd;
+#endif // _WIN32
+
+#include "netClient.h"
+#include "uiInteract.h"
+#include "uiDraw.h"
+#include "rocks.h"             // for ROCK_TIERS
+#include "ship.h"              // for SHIP_SIZE
+#include "bullet.h"
+#include "eventBus.h"          // for EVENT_*
+#include "levelOfDetail.h"
+#include "qualityGovernor.h"
+#include "frameTimer.h"        // for monotonicNow()
+
+using namespace std;
+
+#define CLIENT_CATCH_UP  0.1   // how hard the screen is pulled back on time
+
+static unsigned char buffer[SERVER_PACKET_MAX];   // every client's, one at a time
+
+/******************************************************************
+ * NET CLIENT : CONSTRUCTOR
+ ****************************************************************/
+NetClient::NetClient() : sock((long long)INVALID_SOCKET), pServer(NULL),
+                         watch(SERVER_FLY), range(SERVER_INTEREST_RANGE),
+                         player(-1), closed(false),
+                         keys(0), loss(0), lossCounter(0), score(0),
+                         worldSize(0.0), lastHello(0), newest(-1),
+                         screenTick(0.0), bytesReceived(0), snapshots(0),
+                         lost(0), decodeNs(0)
+{
+}
+
+/******************************************************************
+ * NET CLIENT : DESTRUCTOR
+ ****************************************************************/
+NetClient::~NetClient()
+{
+   close();
+   delete pServer;
+   for (list<Bullet *>::iterator it = debris.begin(); it != debris.end(); it++)
+      delete *it;
+   for (list<Bullet *>::iterator it = stars.begin(); it != stars.end(); it++)
+      delete *it;
+}
+
+/******************************************************************
+ * NET CLIENT : CONNECT
+ * Only the HELLO goes now; poll() says it again until we are
+ * welcomed
+ ****************************************************************/
+bool NetClient::connect(const char * server, int watch, int range)
+{
+   assert(pServer == NULL);
+   string host = "127.0.0.1";
+   string port = server;
+   const char * colon = strchr(server, ':');
+   if (colon)
+   {
+      host = string(server, colon - server);
+      port = colon + 1;
+   }
+
+#ifdef _WIN32
+   WSADATA wsa;
+   if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+      return false;
+#endif // _WIN32
+
+   addrinfo hints;
+   memset(&hints, 0, sizeof(hints));
+   hints.ai_family   = AF_INET;
+   hints.ai_socktype = SOCK_DGRAM;
+   addrinfo * found = NULL;
+   if (getaddrinfo(host.c_str(), port.c_str(), &hints, &found) != 0 || !found)
+      return false;
+   pServer = new sockaddr_in;
+   memcpy(pServer, found->ai_addr, sizeof(*pServer));
+   freeaddrinfo(found);
+
+   Socket s = socket(AF_INET, SOCK_DGRAM, 0);
+   if (s == INVALID_SOCKET)
+      return false;
+   sock = (long long)s;
+   this->watch = watch;
+   this->range = range;
+   sendHello();
+   return true;
+}
+
+/******************************************************************
+ * NET CLIENT : CLOSE
+ ****************************************************************/
+void NetClient::close()
+{
+   if ((Socket)sock == INVALID_SOCKET)
+      return;
+   if (!closed)
+   {
+      BitWriter out(buffer, sizeof(buffer));
+      out.write(SERVER_MAGIC, 32);
+      out.write(SERVER_BYE, 8);
+      int size = out.finish();
+      sendto((Socket)sock, (const char *)buffer, size, 0,
+             (const sockaddr *)pServer, sizeof(*pServer));
+   }
+   closeSocket((Socket)sock);
+   sock = (long long)INVALID_SOCKET;
+   closed = true;
+#ifdef _WIN32
+   WSACleanup();
+#endif // _WIN32
+}
+
+/******************************************************************
+ * NET CLIENT : SEND HELLO
+ ****************************************************************/
+void NetClient::sendHello()
+{
+   BitWriter out(buffer, sizeof(buffer));
+   out.write(SERVER_MAGIC, 32);
+   out.write(SERVER_HELLO, 8);
+   out.writeSigned(watch, 16);
+   out.write(range, 16);
+   int size = out.finish();
+   sendto((Socket)sock, (const char *)buffer, size, 0,
+          (const sockaddr *)pServer, sizeof(*pServer));
+   lastHello = monotonicNow();
+}
+
+/******************************************************************
+ * NET CLIENT : SEND ACK
+ ****************************************************************/
+void NetClient::sendAck(int tick)
+{
+   unsigned char ack[16];
+   BitWriter out(ack, sizeof(ack));
+   out.write(SERVER_MAGIC, 32);
+   out.write(SERVER_ACK, 8);
+   out.writeSigned(tick, 32);
+   out.write(keys, 8);
+   int size = out.finish();
+   sendto((Socket)sock, (const char *)ack, size, 0,
+          (const sockaddr *)pServer, sizeof(*pServer));
+}
+
+/******************************************************************
+ * NET CLIENT : POLL
+ ****************************************************************/
+void NetClient::poll()
+{
+   if (closed || (Socket)sock == INVALID_SOCKET)
+      return;
+   if (!isWelcome() &&
+       monotonicNow() - lastHello > CLIENT_HELLO_MS * 1000000LL)
+      sendHello();
+
+   PollFd waiting = { (Socket)sock, POLLIN, 0 };
+   while (pollSocket(&waiting, 1, 0) > 0)
+   {
+      sockaddr_in from;
+      socklen_t fromSize = sizeof(from);
+      int size = (int)recvfrom((Socket)sock, (char *)buffer, sizeof(buffer), 0,
+                               (sockaddr *)&from, &fromSize);
+      if (size <= 0 || from.sin_port != pServer->sin_port ||
+          from.sin_addr.s_addr != pServer->sin_addr.s_addr)
+         continue;   // not from our server
+      bytesReceived += size;
+
+      BitReader in(buffer, size);
+      if (in.read(32) != SERVER_MAGIC)
+         continue;
+      int type = in.read(8);
+      if (type == SERVER_WELCOME)
+      {
+         player    = in.read(16);
+         worldSize = (float)in.read(16);
+      }
+      else if (type == SERVER_SNAPSHOT && isWelcome())
+         receiveSnapshot(buffer, size);
+      else if (type == SERVER_BYE)
+      {
+         closed = true;
+         return;
+      }
+   }
+}
+
+/******************************************************************
+ * NET CLIENT : RECEIVE SNAPSHOT
+ ****************************************************************/
+void NetClient::receiveSnapshot(const unsigned char * packet, int size)
+{
+   long long begin = monotonicNow();
+   BitReader in(packet, size);
+   in.read(32);                       // magic
+   in.read(8);                        // type
+   int tick      = in.read(32);
+   int baseline  = in.readSigned(32);
+   int viewed    = in.read(16);
+   int newScore  = in.read(32);
+   if (in.isOverrun() || tick <= newest)
+      return;
+
+   // a made-up bad connection, the same every run
+   if (loss > 0 && (int)(lossCounter++ * 37 % 100) < loss)
+   {
+      lost++;
+      return;
+   }
+
+   const Snapshot * pBaseline = NULL;
+   if (baseline >= 0)
+   {
+      pBaseline = &received[baseline % CLIENT_HISTORY];
+      if (pBaseline->tick != baseline || tick - baseline >= CLIENT_HISTORY)
+      {
+         lost++;
+         return;
+      }
+   }
+
+   Snapshot & snapshot = received[tick % CLIENT_HISTORY];
+   if (!snapshot.decode(pBaseline, in))
+   {
+      snapshot.tick = -1;
+      lost++;
+      return;
+   }
+   snapshot.tick = tick;
+   newest = tick;
+   player = viewed;
+   score  = newScore;
+   snapshots++;
+   sendAck(tick);
+
+   // what broke, forgetting anything the screen is never going back for
+   while (!destroyed.empty() && destroyed.front().tick < tick - CLIENT_HISTORY)
+      destroyed.erase(destroyed.begin());
+   int count = in.read(8);
+   for (int i = 0; i < count && !in.isOverrun(); i++)
+   {
+      Destroyed d;
+      d.tick = tick;
+      d.type = in.read(3);
+      d.tier = in.read(2);
+      d.x    = in.readSigned(SNAPSHOT_POSITION_BITS);
+      d.y    = in.readSigned(SNAPSHOT_POSITION_BITS);
+      if (!in.isOverrun())
+         destroyed.push_back(d);
+   }
+   decodeNs += monotonicNow() - begin;
+}
+
+/******************************************************************
+ * BLEND
+ * Part of the way from a to b, unless it jumped, which is
+ * wrapping around the edge of the world
+ ****************************************************************/
+static int blend(int a, int b, double fraction, int jump)
+{
+   if (b - a > jump || a - b > jump)
+      return fraction < 0.5 ? a : b;
+   return a + (int)((b - a) * fraction);
+}
+
+/******************************************************************
+ * NET CLIENT : INTERPOLATE
+ * Both snapshots are in order of id, so they are walked side by
+ * side.  Something in only one of them shows for the half of the
+ * way nearer that one
+ ****************************************************************/
+bool NetClient::interpolate(double tick, vector<EntityState> & out) const
+{
+   const Snapshot * pFrom = NULL;
+   const Snapshot * pTo   = NULL;
+   for (int i = 0; i < CLIENT_HISTORY; i++)
+   {
+      const Snapshot & s = received[i];
+      if (s.tick < 0)
+         continue;
+      if (s.tick <= tick && (!pFrom || s.tick > pFrom->tick))
+         pFrom = &s;
+      if (s.tick > tick && (!pTo || s.tick < pTo->tick))
+         pTo = &s;
+   }
+   if (!pFrom && !pTo)
+      return false;
+   if (!pFrom || !pTo)
+   {
+      out = pFrom ? pFrom->entities : pTo->entities;
+      return true;
+   }
+
+   double fraction = (tick - pFrom->tick) / (pTo->tick - pFrom->tick);
+   int jump = quantise(worldSize);
+   const vector<EntityState> & from = pFrom->entities;
+   const vector<EntityState> & to   = pTo->entities;
+   out.clear();
+   size_t i = 0;
+   size_t j = 0;
+   while (i < from.size() || j < to.size())
+   {
+      if (j >= to.size() || (i < from.size() && from[i].id < to[j].id))
+      {
+         if (fraction < 0.5)
+            out.push_back(from[i]);
+         i++;
+      }
+      else if (i >= from.size() || to[j].id < from[i].id)
+      {
+         if (fraction >= 0.5)
+            out.push_back(to[j]);
+         j++;
+      }
+      else
+      {
+         EntityState e = fraction < 0.5 ? from[i] : to[j];
+         e.x = blend(from[i].x, to[j].x, fraction, jump);
+         e.y = blend(from[i].y, to[j].y, fraction, jump);
+         signed char turn = (signed char)(to[j].rotation - from[i].rotation);
+         e.rotation = (unsigned char)(from[i].rotation + (int)(turn * fraction));
+         out.push_back(e);
+         i++;
+         j++;
+      }
+   }
+   return true;
+}
+
+/******************************************************************
+ * DRAW ENTITY
+ * Each kind the way the game itself draws it
+ ****************************************************************/
+static void drawEntity(const EntityState & e)
+{
+   Point point(unquantise(e.x), unquantise(e.y));
+   int rotation = unquantiseRotation(e.rotation);
+   switch (e.kind)
+   {
+      case ENTITY_SHIP:
+         if (e.detail & ENTITY_ALIVE)
+            drawShip(point, rotation, (e.detail & ENTITY_THRUSTING) != 0);
+         break;
+      case ENTITY_ROCK:
+      {
+         const RockTier & tier = ROCK_TIERS[e.detail < ROCK_TIER_COUNT ? e.detail : ROCK_SMALL];
+         drawAsteroid(tier.mesh, point, rotation, LevelOfDetail::select(tier.size));
+         break;
+      }
+      case ENTITY_BULLET:
+         if (e.detail == 0 || !QualityGovernor::isSpriteWeapons())
+            batchDot(point, 1.0, 1.0, 1.0);
+         else if (e.detail == 1)
+            drawSacredBird(point, 10);
+         else if (e.detail == 2)
+            drawNumber(point, random(0, 9));
+         else if (e.detail == 3)
+            drawPizza(point, rotation);
+         break;
+   }
+}
+
+/******************************************************************
+ * NET CLIENT : DRAW EFFECTS
+ * Our own stars, and debris for whatever broke up to where the
+ * screen is now, moved along a tick and drawn
+ ****************************************************************/
+void NetClient::drawEffects()
+{
+   if (stars.empty())
+      Bullet::scatterStars(stars, BULLET_STARS);
+   while (!destroyed.empty() && destroyed.front().tick <= screenTick)
+   {
+      const Destroyed & d = destroyed.front();
+      int size = d.type == EVENT_SHIP_KILLED ? SHIP_SIZE :
+                 ROCK_TIERS[d.tier < ROCK_TIER_COUNT ? d.tier : ROCK_SMALL].size;
+      Bullet::explode(debris, Point(unquantise(d.x), unquantise(d.y)), size,
+                      d.type == EVENT_SHIP_KILLED ? 3 : 1);
+      destroyed.erase(destroyed.begin());
+   }
+
+   for (list<Bullet *>::iterator it = stars.begin(); it != stars.end(); it++)
+   {
+      (*it)->advance();
+      if (camera.isVisible((*it)->getPosition(), 0.0))
+         (*it)->draw();
+   }
+   list<Bullet *>::iterator it = debris.begin();
+   while (it != debris.end())
+   {
+      (*it)->advance();
+      if (!(*it)->isAlive())
+      {
+         delete *it;
+         it = debris.erase(it);
+         continue;
+      }
+      if (camera.isVisible((*it)->getPosition(), 0.0))
+         (*it)->draw();
+      it++;
+   }
+}
+
+/******************************************************************
+ * NET CLIENT : DRAW
+ * The screen moves one tick a frame, nudged toward staying
+ * CLIENT_BEHIND_TICKS behind the newest snapshot.  If it falls far
+ * behind or runs out of snapshots it jumps
+ ****************************************************************/
+void NetClient::draw(const Interface & ui)
+{
+   if (newest < 0)
+   {
+      camera.applyScreen();
+      drawStaticText(Point(-60, 0), isClosed() ? "The server went away"
+                                               : "Waiting for the server");
+      return;
+   }
+
+   double target = newest - CLIENT_BEHIND_TICKS;
+   if (screenTick < target - CLIENT_BEHIND_TICKS || screenTick > newest)
+      screenTick = target;
+   else
+      screenTick += 1.0 + (target - screenTick) * CLIENT_CATCH_UP;
+   interpolate(screenTick, shown);
+
+   for (size_t i = 0; i < shown.size(); i++)
+      if (shown[i].kind == ENTITY_SHIP && shown[i].owner == player)
+         camera.follow(Point(unquantise(shown[i].x), unquantise(shown[i].y)));
+   camera.applyWorld();
+   LevelOfDetail::setScale(camera.getScale());
+   QualityGovernor::update(ui.getLastWorkTime(),
+                           (long long)(ui.frameRate() * 1000000000.0));
+   drawEffects();
+
+   for (size_t i = 0; i < shown.size(); i++)
+      if (camera.isVisible(Point(unquantise(shown[i].x), unquantise(shown[i].y)),
+                           BIG_ROCK_SIZE * 2))
+         drawEntity(shown[i]);
+   flushMeshes();
+   flushBatches();
+
+   camera.applyScreen();
+   drawNumber(Point(camera.getScreenXMin() + 10, camera.getScreenYMax() - 10),
+              score);
+   if (isClosed())
+      drawStaticText(Point(-60, 0), "The server went away");
+}
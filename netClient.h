@@ -0,0 +1,141 @@
+/***********************************************************************
+ * Header File:
+ *    Net Client : the game as a server shows it
+ * Summary:
+ *    A client keeps no game of its own, just the last few snapshots the
+ *    server sent.  Snapshots come once a tick and may arrive late or
+ *    not at all, so the screen runs a couple of ticks behind the newest
+ *    one and everything on it is moved smoothly between the two
+ *    snapshots either side of that moment.
+ *
+ *    Every snapshot that comes in is answered with the tick it was and
+ *    the keys being held, so the server knows what to send the next one
+ *    against and where to fly our ship.
+ *
+ *    The server only sends what is near our ship, and never the stars
+ *    or debris.  The client scatters stars of its own and throws up
+ *    debris wherever the server says something was destroyed, when the
+ *    screen gets to that tick.
+ ************************************************************************/
+
+#ifndef NET_CLIENT_H
+#define NET_CLIENT_H
+
+#include <vector>
+#include <list>
+#include "snapshot.h"
+#include "server.h"
+#include "camera.h"
+
+class Interface;
+class Bullet;
+struct sockaddr_in;
+
+#define CLIENT_HISTORY       SERVER_HISTORY   // snapshots kept
+#define CLIENT_BEHIND_TICKS  2                // how far the screen lags
+#define CLIENT_HELLO_MS      250              // say hello this often
+#define CLIENT_CONNECT_MS    10000            // how long to wait for a welcome
+
+/*********************************************
+ * NET CLIENT
+ * One connection to a server.  A benchmark
+ * may have many in one process
+ *********************************************/
+class NetClient
+{
+public:
+   NetClient();
+   ~NetClient();
+
+   // find the server at "host:port", or just "port" on this machine,
+   // and ask to fly a ship of our own, or SERVER_FLY, or to watch
+   // this player, seeing this far around it.  False if there is no
+   // such host
+   bool connect(const char * server, int watch,
+                int range = SERVER_INTEREST_RANGE);
+
+   // say goodbye
+   void close();
+
+   // read whatever the server sent and answer it
+   void poll();
+
+   bool isWelcome()   const { return player >= 0; }
+   bool isClosed()    const { return closed;      }
+   int  getPlayer()   const { return player;      }
+   int  getScore()    const { return score;       }
+   float getWorldSize() const { return worldSize; }
+   int  getNewestTick() const { return newest;    }
+
+   // what we hold, sent with the next answer
+   void setKeys(int keys) { this->keys = keys; }
+
+   // for testing: throw away this percent of the snapshots
+   void setLoss(int percent) { loss = percent; }
+
+   // everything as it was at this tick, which may fall between two
+   // snapshots.  False if there is nothing to show yet
+   bool interpolate(double tick, std::vector<EntityState> & out) const;
+
+   // what part of the world is on the screen
+   Camera & getCamera() { return camera; }
+
+   // keep the screen a little behind the snapshots and draw what was
+   // there then, following our player
+   void draw(const Interface & ui);
+
+   long long getBytesReceived() const { return bytesReceived; }
+   long long getSnapshots()     const { return snapshots;     }
+   long long getLost()          const { return lost;          }   // thrown away or undecodable
+   long long getDecodeNs()      const { return decodeNs;      }
+
+private:
+   void sendHello();
+   void sendAck(int tick);
+   void receiveSnapshot(const unsigned char * buffer, int size);
+   void drawEffects();
+
+   /*********************************************
+    * DESTROYED
+    * A rock or ship the server said broke, and
+    * when, waiting for the screen to get there
+    *********************************************/
+   struct Destroyed
+   {
+      int tick;
+      int type;    // EVENT_ROCK_DESTROYED or EVENT_SHIP_KILLED
+      int tier;    // for a rock
+      int x;
+      int y;
+   };
+
+   long long     sock;            // a Socket, whatever that is here
+   sockaddr_in * pServer;
+   int           watch;
+   int           range;
+   int           player;          // -1 until welcomed
+   bool          closed;
+   int           keys;
+   int           loss;
+   unsigned int  lossCounter;
+   int           score;
+   float         worldSize;       // half the arena's width
+   long long     lastHello;
+
+   Snapshot      received[CLIENT_HISTORY];   // by tick % CLIENT_HISTORY
+   int           newest;          // newest tick decoded, -1 for none
+
+   double        screenTick;      // where the screen is, in ticks
+   Camera        camera;
+   std::vector<EntityState> shown;
+   std::vector<Destroyed>   destroyed;   // by tick
+   std::list<Bullet *>      debris;
+   std::list<Bullet *>      stars;
+
+   long long     bytesReceived;
+   long long     snapshots;
+   long long     lost;
+   long long     decodeNs;
+};
+
+#endif // NET_CLIENT_H
@@ -0,0 +1,328 @@
+/***********************************************************************
+ * Source File:
+ *    Options : what the user asked for on the command line
+ * Summary:
+ *    A hand-rolled parser.  Options are a dash and a word, optionally
+ *    followed by one value.
+ ************************************************************************/
+
+#include <iostream>   // for CERR
+#include <cstring>    // for strcmp()
+#include <cstdlib>    // for atof(), atoi() and atoll()
+#include "options.h"
+#include "world.h"
+#include "game.h"     // for INITIAL_ROCK_COUNT
+#include "qualityGovernor.h"
+#include "autopilot.h"
+#include "lockstep.h"
+#include "rollback.h"
+#include "server.h"
+
+using namespace std;
+
+/******************************************************************
+ * OPTIONS : CONSTRUCTOR
+ * The defaults play the game the way it always has
+ ****************************************************************/
+Options::Options() : fps(30.0),
+                     showStats(false),
+                     worldSize(WORLD_DEFAULT_SIZE),
+                     zoom(1.0),
+                     rockCount(INITIAL_ROCK_COUNT),
+                     quality(-1),
+                     capture(NULL),
+                     events(NULL),
+                     metrics(NULL),
+                     trace(NULL),
+                     perfInterval(0),
+                     autopilot(-1),
+                     aggression(AUTOPILOT_DEFAULT_KNOB),
+                     bots(0),
+                     seed(-1),
+                     headless(0),
+                     lockstepSide(0),
+                     lockstepPort(0),
+                     lockstepPeer(NULL),
+                     delay(LOCKSTEP_DEFAULT_DELAY),
+                     rollback(0),
+                     servePort(0),
+                     server(NULL),
+                     watch(SERVER_FLY),
+                     broadcast(NULL),
+                     spectate(NULL),
+                     record(NULL),
+                     replay(NULL),
+                     seek(-1),
+                     benchCount(0),
+                     benchFiles(NULL),
+                     allocBudget(-1),
+                     allocAbort(false),
+                     allocReport(false)
+{
+}
+
+/******************************************************************
+ * OPTIONS : PARSE
+ * Walk the command line looking for options we know about.
+ *   INPUT   argc, argv   straight from main()
+ *   OUTPUT  <return>     false if the command line is malformed
+ ****************************************************************/
+bool Options::parse(int argc, char ** argv)
+{
+   for (int i = 1; i < argc; i++)
+   {
+      const char * arg = argv[i];
+      bool hasValue = (i + 1 < argc);
+
+      if (strcmp(arg, "-stats") == 0)
+         showStats = true;
+      else if (strcmp(arg, "-fps") == 0)
+      {
+         if (!hasValue || (fps = atof(argv[++i])) <= 0.0)
+            return false;
+      }
+      else if (strcmp(arg, "-world") == 0)
+      {
+         if (!hasValue || (worldSize = (float)atof(argv[++i])) <= 0.0)
+            return false;
+      }
+      else if (strcmp(arg, "-zoom") == 0)
+      {
+         if (!hasValue || (zoom = (float)atof(argv[++i])) <= 0.0)
+            return false;
+      }
+      else if (strcmp(arg, "-rocks") == 0)
+      {
+         if (!hasValue || (rockCount = atoi(argv[++i])) < 0)
+            return false;
+      }
+      else if (strcmp(arg, "-quality") == 0)
+      {
+         if (!hasValue)
+            return false;
+         quality = atoi(argv[++i]);
+         if (quality > QUALITY_WORST)
+            return false;
+      }
+      else if (strcmp(arg, "-capture") == 0)
+      {
+         if (!hasValue)
+            return false;
+         capture = argv[++i];
+      }
+      else if (strcmp(arg, "-events") == 0)
+      {
+         if (!hasValue)
+            return false;
+         events = argv[++i];
+      }
+      else if (strcmp(arg, "-metrics") == 0)
+      {
+         if (!hasValue)
+            return false;
+         metrics = argv[++i];
+      }
+      else if (strcmp(arg, "-trace") == 0)
+      {
+         if (!hasValue)
+            return false;
+         trace = argv[++i];
+      }
+      else if (strcmp(arg, "-perf") == 0)
+      {
+         if (!hasValue || (perfInterval = atoi(argv[++i])) <= 0)
+            return false;
+      }
+      else if (strcmp(arg, "-autopilot") == 0)
+      {
+         if (!hasValue)
+            return false;
+         autopilot = atoi(argv[++i]);
+         if (autopilot < 0 || autopilot > AUTOPILOT_KNOB_MAX)
+            return false;
+      }
+      else if (strcmp(arg, "-aggression") == 0)
+      {
+         if (!hasValue)
+            return false;
+         aggression = atoi(argv[++i]);
+         if (aggression < 0 || aggression > AUTOPILOT_KNOB_MAX)
+            return false;
+      }
+      else if (strcmp(arg, "-bots") == 0)
+      {
+         if (!hasValue || (bots = atoi(argv[++i])) < 0)
+            return false;
+      }
+      else if (strcmp(arg, "-seed") == 0)
+      {
+         if (!hasValue || (seed = atoll(argv[++i])) < 0)
+            return false;
+      }
+      else if (strcmp(arg, "-headless") == 0)
+      {
+         if (!hasValue || (headless = atoi(argv[++i])) <= 0)
+            return false;
+      }
+      else if (strcmp(arg, "-lockstep") == 0)
+      {
+         if (i + 3 >= argc)
+            return false;
+         lockstepSide = atoi(argv[++i]);
+         lockstepPort = atoi(argv[++i]);
+         lockstepPeer = argv[++i];
+         if ((lockstepSide != 0 && lockstepSide != 1) ||
+             lockstepPort <= 0 || lockstepPort > 65535)
+            return false;
+      }
+      else if (strcmp(arg, "-delay") == 0)
+      {
+         if (!hasValue)
+            return false;
+         delay = atoi(argv[++i]);
+         if (delay < 0 || delay > LOCKSTEP_MAX_DELAY)
+            return false;
+      }
+      else if (strcmp(arg, "-rollback") == 0)
+      {
+         if (!hasValue)
+            return false;
+         rollback = atoi(argv[++i]);
+         if (rollback < 0 || rollback > ROLLBACK_MAX_TICKS)
+            return false;
+      }
+      else if (strcmp(arg, "-serve") == 0)
+      {
+         if (!hasValue)
+            return false;
+         servePort = atoi(argv[++i]);
+         if (servePort <= 0 || servePort > 65535)
+            return false;
+      }
+      else if (strcmp(arg, "-connect") == 0)
+      {
+         if (!hasValue)
+            return false;
+         server = argv[++i];
+      }
+      else if (strcmp(arg, "-watch") == 0)
+      {
+         if (!hasValue || (watch = atoi(argv[++i])) < 0)
+            return false;
+      }
+      else if (strcmp(arg, "-broadcast") == 0)
+      {
+         if (!hasValue)
+            return false;
+         broadcast = argv[++i];
+      }
+      else if (strcmp(arg, "-spectate") == 0)
+      {
+         if (!hasValue)
+            return false;
+         spectate = argv[++i];
+      }
+      else if (strcmp(arg, "-record") == 0)
+      {
+         if (!hasValue)
+            return false;
+         record = argv[++i];
+      }
+      else if (strcmp(arg, "-replay") == 0)
+      {
+         if (!hasValue)
+            return false;
+         replay = argv[++i];
+      }
+      else if (strcmp(arg, "-seek") == 0)
+      {
+         if (!hasValue || (seek = atoi(argv[++i])) < 0)
+            return false;
+      }
+      else if (strcmp(arg, "-bench") == 0)
+      {
+         // everything after -bench is a scenario
+         benchFiles = argv + i + 1;
+         benchCount = argc - i - 1;
+         if (benchCount == 0)
+            return false;
+         break;
+      }
+      else if (strcmp(arg, "-allocbudget") == 0)
+      {
+         if (!hasValue)
+            return false;
+         allocBudget = atoll(argv[++i]);
+      }
+      else if (strcmp(arg, "-allocabort") == 0)
+         allocAbort = true;
+      else if (strcmp(arg, "-allocreport") == 0)
+         allocReport = true;
+   }
+
+   return true;
+}
+
+/******************************************************************
+ * OPTIONS : USAGE
+ * Display the options we understand
+ ****************************************************************/
+void Options::usage(const char * program) const
+{
+   cerr << "Usage: " << program << " [options]\n"
+        << "   -fps <n>      frames per second (default 30)\n"
+        << "   -stats        show frame time, entity counters and input latency;\n"
+        << "                 the latency is reported again on the way out\n"
+        << "   -world <n>    half the width of the arena (default 200)\n"
+        << "   -zoom <n>     world units per pixel, more sees farther (default 1)\n"
+        << "   -rocks <n>    big rocks at the start (default 5)\n"
+        << "   -quality <n>  hold the eye candy at 0 (best) to 4 (least);\n"
+        << "                 by default it drops when frames run long\n"
+        << "   -capture <path> record every frame: path.y4m is a YUV4MPEG2\n"
+        << "                 stream, path.raw is RGB24, anything else is a\n"
+        << "                 path_000000.ppm sequence\n"
+        << "   -events <path> write every game event to path as it happens\n"
+        << "   -metrics <port|path> serve Prometheus counters on\n"
+        << "                 127.0.0.1:port or a Unix socket at path\n"
+        << "   -trace <path> write a Chrome trace of every frame to path\n"
+        << "   -perf <n>     read the CPU's counters every n frames (Linux)\n"
+        << "   -autopilot <n> let the bot play, difficulty 0 to 10\n"
+        << "   -aggression <n> how often the bot fires and chases, 0 to 10\n"
+        << "                 (default 5)\n"
+        << "   -bots <n>     n more ships flown by bots, at the -autopilot\n"
+        << "                 difficulty and -aggression\n"
+        << "   -seed <n>     start the simulation from this seed\n"
+        << "   -headless <n> play n ticks without a window and print the\n"
+        << "                 state hash; the autopilot flies if asked to\n"
+        << "   -lockstep <side> <port> <peer>  play against another copy:\n"
+        << "                 side 0 or 1, our UDP port, and the peer's\n"
+        << "                 host:port or just port on this machine\n"
+        << "   -delay <n>    ticks between a key and its effect in lockstep,\n"
+        << "                 0 to 16 (default 3)\n"
+        << "   -rollback <n> in lockstep, play without waiting for the peer,\n"
+        << "                 going back up to n ticks (1 to 16) when a guess\n"
+        << "                 at its keys was wrong; try with -delay 0\n"
+        << "   -serve <port> run the game without a window for clients to\n"
+        << "                 fly in and watch over UDP; -headless <n> stops\n"
+        << "                 it after n ticks\n"
+        << "   -connect <host:port>  fly a ship in a server's game, or just\n"
+        << "                 port on this machine\n"
+        << "   -watch <n>    with -connect, watch player n instead\n"
+        << "   -broadcast <name>  publish every frame to /dev/shm/name for\n"
+        << "                 spectators on this machine\n"
+        << "   -spectate <name>  watch a game's broadcast; -headless <n>\n"
+        << "                 reads n frames and reports\n"
+        << "   -record <path> save a replay of the game, not with -lockstep\n"
+        << "                 or -serve\n"
+        << "   -replay <path> play a replay from -seek <tick>, the left and\n"
+        << "                 right arrows jumping ten seconds; -headless <n>\n"
+        << "                 times n seeks, then goes to -seek <tick> or the\n"
+        << "                 end and prints the state hash\n"
+        << "   -bench <file>...  run scenarios without a window and report\n"
+        << "                 ticks per second, the worst tick and a state hash;\n"
+        << "                 must come last\n"
+        << "   -allocbudget <n>  flag frames that allocate more than n times\n"
+        << "   -allocabort   stop with a report when over the budget\n"
+        << "   -allocreport  print the allocation report at exit\n"
+        << "   (allocation options need a build with CFLAGS=-DALLOC_TRACKER)\n";
+}
@@ -0,0 +1,71 @@
+/***********************************************************************
+ * Header File:
+ *    Options : what the user asked for on the command line
+ * Summary:
+ *    Everything that can be changed when the game is launched.  Each
+ *    option has a sensible default so running with no arguments plays
+ *    the game the way it always has.
+ ************************************************************************/
+
+#ifndef OPTIONS_H
+#define OPTIONS_H
+
+/*********************************************
+ * OPTIONS
+ * The parsed command line
+ *********************************************/
+class Options
+{
+public:
+   Options();
+
+   // read our options out of the command line.  Anything we do not
+   // recognize is left for GLUT.  Returns false if an option is missing
+   // its value
+   bool parse(int argc, char ** argv);
+
+   // tell the user what we understand
+   void usage(const char * program) const;
+
+   double fps;          // -fps <n>    frames per second
+   bool   showStats;    // -stats      draw the frame and entity counters
+   float  worldSize;    // -world <n>  half the width of the arena
+   float  zoom;         // -zoom <n>   world units per pixel
+   int    rockCount;    // -rocks <n>  big rocks to start with
+   int    quality;      // -quality <n> hold the quality here, -1 adapts
+   const char * capture; // -capture <path> record every frame, or NULL
+   const char * events;  // -events <path>  log game events, or NULL
+   const char * metrics; // -metrics <port|path> serve counters, or NULL
+   const char * trace;   // -trace <path>   timeline of every frame, or NULL
+   int    perfInterval;  // -perf <n>  sample hardware counters every n frames
+   int    autopilot;     // -autopilot <n> let the bot fly at this difficulty
+   int    aggression;    // -aggression <n> how trigger happy the bot is
+   int    bots;          // -bots <n>  more ships flown by bots
+   long long seed;       // -seed <n>  for the simulation, -1 picks one
+   int    headless;      // -headless <n> play n ticks without a window
+
+   int    lockstepSide;  // -lockstep <side> <port> <peer>
+   int    lockstepPort;  //    play against a peer over UDP
+   const char * lockstepPeer;   // or NULL
+   int    delay;         // -delay <n> ticks of input delay for lockstep
+   int    rollback;      // -rollback <n> guess the peer up to n ticks ahead
+
+   int    servePort;     // -serve <port> run the game for clients, or 0
+   const char * server;  // -connect <host:port> show a server's game, or NULL
+   int    watch;         // -watch <n> just watch this player, -1 to fly
+
+   const char * broadcast;  // -broadcast <name> publish every frame, or NULL
+   const char * spectate;   // -spectate <name>  show a broadcast, or NULL
+   const char * record;     // -record <path>    save a replay, or NULL
+   const char * replay;     // -replay <path>    play one back, or NULL
+   int    seek;          // -seek <tick>  where to start a replay, or -1
+
+   int     benchCount;    // -bench <file>...  run these scenarios headless
+   char ** benchFiles;
+
+   long long allocBudget;  // -allocbudget <n>  allocations allowed per frame
+   bool      allocAbort;   // -allocabort       stop when over the budget
+   bool      allocReport;  // -allocreport      print allocations at exit
+};
+
+#endif // OPTIONS_H
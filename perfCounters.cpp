@@ -0,0 +1,313 @@
+/***********************************************************************
+ * Source File:
+ *    Perf Counters : what the CPU was doing during each phase
+ * Summary:
+ *    Each counter is opened on its own rather than as a group, so a
+ *    machine missing one event still gives us the rest.  The kernel
+ *    may share the hardware between more events than it has registers
+ *    for; reading the time each counter was enabled and running lets
+ *    us scale the count back up to what it would have been.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for memset()
+#include <iomanip>    // for setprecision()
+
+#ifdef __linux__
+#include <unistd.h>             // for read(), close() and syscall()
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif // __linux__
+
+#include "perfCounters.h"
+
+using namespace std;
+
+/*********************************************
+ * COUNTER READING
+ * A counter's value along with how long it was
+ * enabled and actually on the hardware
+ *********************************************/
+struct CounterReading
+{
+   unsigned long long value;
+   unsigned long long enabled;
+   unsigned long long running;
+};
+
+static int            fds[PERF_COUNTER_COUNT];
+static CounterReading before[PERF_COUNTER_COUNT];
+static PerfSample     last[PERF_PHASE_COUNT];
+static PerfSample     total[PERF_PHASE_COUNT];
+static int            sampleInterval = 0;
+static long long      frameCount = 0;
+
+bool PerfCounters::available = false;
+bool PerfCounters::sampling  = false;
+
+#ifdef __linux__
+/******************************************************************
+ * OPEN COUNTER
+ * One hardware event for this thread, user space only, running
+ * from the start
+ ****************************************************************/
+static int openCounter(unsigned int type, unsigned long long config)
+{
+   perf_event_attr attr;
+   memset(&attr, 0, sizeof(attr));
+   attr.size           = sizeof(attr);
+   attr.type           = type;
+   attr.config         = config;
+   attr.exclude_kernel = 1;
+   attr.exclude_hv     = 1;
+   attr.read_format    = PERF_FORMAT_TOTAL_TIME_ENABLED |
+                         PERF_FORMAT_TOTAL_TIME_RUNNING;
+   return (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+}
+#endif // __linux__
+
+/******************************************************************
+ * READ COUNTER
+ *   OUTPUT <return>  false if the counter is closed or unreadable
+ ****************************************************************/
+static bool readCounter(int counter, CounterReading & reading)
+{
+#ifdef __linux__
+   return fds[counter] >= 0 &&
+          read(fds[counter], &reading, sizeof(reading)) ==
+             (ssize_t)sizeof(reading);
+#else
+   return false;
+#endif // __linux__
+}
+
+/******************************************************************
+ * PERF COUNTERS : START
+ *   INPUT  interval  measure one frame in this many
+ *   OUTPUT <return>  false if no counter could be opened
+ ****************************************************************/
+bool PerfCounters::start(int interval)
+{
+   assert(interval > 0);
+   sampleInterval = interval;
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      fds[i] = -1;
+
+#ifdef __linux__
+   const unsigned long long l1dMiss = PERF_COUNT_HW_CACHE_L1D |
+      (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+      (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+   fds[PERF_CYCLES]        = openCounter(PERF_TYPE_HARDWARE,
+                                         PERF_COUNT_HW_CPU_CYCLES);
+   fds[PERF_INSTRUCTIONS]  = openCounter(PERF_TYPE_HARDWARE,
+                                         PERF_COUNT_HW_INSTRUCTIONS);
+   fds[PERF_L1D_MISSES]    = openCounter(PERF_TYPE_HW_CACHE, l1dMiss);
+   fds[PERF_LLC_MISSES]    = openCounter(PERF_TYPE_HARDWARE,
+                                         PERF_COUNT_HW_CACHE_MISSES);
+   fds[PERF_BRANCH_MISSES] = openCounter(PERF_TYPE_HARDWARE,
+                                         PERF_COUNT_HW_BRANCH_MISSES);
+#endif // __linux__
+
+   available = false;
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      if (fds[i] >= 0)
+         available = true;
+   return available;
+}
+
+/******************************************************************
+ * PERF COUNTERS : STOP
+ ****************************************************************/
+void PerfCounters::stop()
+{
+#ifdef __linux__
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      if (fds[i] >= 0)
+         close(fds[i]);
+#endif // __linux__
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      fds[i] = -1;
+   available = false;
+   sampling  = false;
+}
+
+/******************************************************************
+ * PERF COUNTERS : RESET
+ ****************************************************************/
+void PerfCounters::reset()
+{
+   memset(last,  0, sizeof(last));
+   memset(total, 0, sizeof(total));
+   frameCount = 0;
+}
+
+/******************************************************************
+ * PERF COUNTERS : IS COUNTER AVAILABLE
+ ****************************************************************/
+bool PerfCounters::isCounterAvailable(int counter)
+{
+   assert(counter >= 0 && counter < PERF_COUNTER_COUNT);
+   return available && fds[counter] >= 0;
+}
+
+/******************************************************************
+ * PERF COUNTERS : BEGIN FRAME
+ ****************************************************************/
+void PerfCounters::beginFrame()
+{
+   sampling = available && (frameCount++ % sampleInterval == 0);
+}
+
+/******************************************************************
+ * PERF COUNTERS : BEGIN
+ * Remember where every counter stood
+ ****************************************************************/
+void PerfCounters::begin(int phase)
+{
+   assert(phase >= 0 && phase < PERF_PHASE_COUNT);
+   if (!sampling)
+      return;
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      if (!readCounter(i, before[i]))
+         before[i].value = before[i].enabled = before[i].running = 0;
+}
+
+/******************************************************************
+ * PERF COUNTERS : END
+ * The difference, scaled up if the counter was only on the
+ * hardware for part of the time
+ *   INPUT  phase      which one just finished
+ *          entities   how many things it worked on
+ ****************************************************************/
+void PerfCounters::end(int phase, long long entities)
+{
+   assert(phase >= 0 && phase < PERF_PHASE_COUNT);
+   if (!sampling)
+      return;
+
+   CounterReading after;
+   PerfSample & sample = last[phase];
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+   {
+      sample.counts[i] = 0;
+      if (!readCounter(i, after))
+         continue;
+      unsigned long long value   = after.value   - before[i].value;
+      unsigned long long enabled = after.enabled - before[i].enabled;
+      unsigned long long running = after.running - before[i].running;
+      if (running == 0)
+         continue;
+      if (running < enabled)
+         value = (unsigned long long)((double)value * enabled / running);
+      sample.counts[i] = (long long)value;
+   }
+   sample.entities = entities;
+   sample.samples  = 1;
+
+   for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      total[phase].counts[i] += sample.counts[i];
+   total[phase].entities += entities;
+   total[phase].samples++;
+}
+
+/******************************************************************
+ * PERF COUNTERS : GET LAST / GET TOTAL
+ ****************************************************************/
+const PerfSample & PerfCounters::getLast(int phase)
+{
+   assert(phase >= 0 && phase < PERF_PHASE_COUNT);
+   return last[phase];
+}
+
+const PerfSample & PerfCounters::getTotal(int phase)
+{
+   assert(phase >= 0 && phase < PERF_PHASE_COUNT);
+   return total[phase];
+}
+
+/******************************************************************
+ * PERF COUNTERS : GET IPC
+ ****************************************************************/
+double PerfCounters::getIpc(const PerfSample & sample)
+{
+   if (sample.counts[PERF_CYCLES] == 0)
+      return 0.0;
+   return (double)sample.counts[PERF_INSTRUCTIONS] /
+          sample.counts[PERF_CYCLES];
+}
+
+/******************************************************************
+ * PERF COUNTERS : GET PER ENTITY
+ ****************************************************************/
+double PerfCounters::getPerEntity(const PerfSample & sample, int counter)
+{
+   assert(counter >= 0 && counter < PERF_COUNTER_COUNT);
+   if (sample.entities == 0)
+      return 0.0;
+   return (double)sample.counts[counter] / sample.entities;
+}
+
+/******************************************************************
+ * PERF COUNTERS : PHASE NAME / COUNTER NAME
+ ****************************************************************/
+const char * PerfCounters::phaseName(int phase)
+{
+   static const char * names[PERF_PHASE_COUNT] =
+   {
+      "advance", "collisions", "cleanup", "draw"
+   };
+   return (phase >= 0 && phase < PERF_PHASE_COUNT) ? names[phase] : "unknown";
+}
+
+const char * PerfCounters::counterName(int counter)
+{
+   static const char * names[PERF_COUNTER_COUNT] =
+   {
+      "cycles", "instructions", "l1d_misses", "llc_misses", "branch_misses"
+   };
+   return (counter >= 0 && counter < PERF_COUNTER_COUNT) ?
+      names[counter] : "unknown";
+}
+
+/******************************************************************
+ * PERF COUNTERS : WRITE JSON
+ * Counters we could not open are null rather than zero, so nobody
+ * mistakes "unavailable" for "never missed"
+ ****************************************************************/
+void PerfCounters::writeJson(ostream & out)
+{
+   // the caller's stream goes back the way it was: a benchmark writes
+   // more numbers to it after this
+   ios::fmtflags flags = out.flags();
+   streamsize precision = out.precision();
+
+   out << "{\"available\":" << (available ? "true" : "false")
+       << ",\"phases\":{";
+   for (int phase = 0; phase < PERF_PHASE_COUNT; phase++)
+   {
+      const PerfSample & sample = total[phase];
+      out << (phase ? "," : "") << '"' << phaseName(phase) << "\":{"
+          << "\"samples\":" << sample.samples;
+      for (int i = 0; i < PERF_COUNTER_COUNT; i++)
+      {
+         out << ",\"" << counterName(i) << "\":";
+         if (isCounterAvailable(i))
+            out << sample.counts[i];
+         else
+            out << "null";
+      }
+      out << fixed << setprecision(3);
+      if (isCounterAvailable(PERF_CYCLES) &&
+          isCounterAvailable(PERF_INSTRUCTIONS))
+         out << ",\"ipc\":" << getIpc(sample);
+      for (int i = PERF_L1D_MISSES; i < PERF_COUNTER_COUNT; i++)
+         if (isCounterAvailable(i))
+            out << ",\"" << counterName(i) << "_per_entity\":"
+                << getPerEntity(sample, i);
+      out.flags(flags);
+      out.precision(precision);
+      out << '}';
+   }
+   out << "}}";
+}
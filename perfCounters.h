@@ -0,0 +1,93 @@
+/***********************************************************************
+ * Header File:
+ *    Perf Counters : what the CPU was doing during each phase
+ * Summary:
+ *    Timing says a phase is slow; the hardware counters say why.  On
+ *    Linux, perf_event_open() gives us cycles, instructions, L1 data
+ *    and last-level cache misses, and branch misses for this thread.
+ *    Every so many frames we read them before and after each phase of
+ *    the tick, which turns into instructions per cycle and misses per
+ *    entity.  A phase with low IPC and lots of misses per entity is
+ *    waiting on memory, not doing arithmetic.
+ *
+ *    Counters the kernel or the machine will not give us are simply
+ *    left out.  With none at all, or on another platform, everything
+ *    here does nothing.
+ ************************************************************************/
+
+#ifndef PERF_COUNTERS_H
+#define PERF_COUNTERS_H
+
+#include <iostream>
+
+#define PERF_CYCLES          0
+#define PERF_INSTRUCTIONS    1
+#define PERF_L1D_MISSES      2
+#define PERF_LLC_MISSES      3
+#define PERF_BRANCH_MISSES   4
+#define PERF_COUNTER_COUNT   5
+
+#define PERF_PHASE_ADVANCE     0   // moving everything
+#define PERF_PHASE_COLLISIONS  1   // checkForCollisions()
+#define PERF_PHASE_CLEANUP     2   // cleanUpZombies() and the grids
+#define PERF_PHASE_DRAW        3   // Game::draw()
+#define PERF_PHASE_COUNT       4
+
+/*********************************************
+ * PERF SAMPLE
+ * Counter totals for one phase
+ *********************************************/
+struct PerfSample
+{
+   long long counts[PERF_COUNTER_COUNT];
+   long long entities;   // summed over the samples, for per-entity rates
+   long long samples;    // how many times the phase was measured
+};
+
+/*********************************************
+ * PERF COUNTERS
+ * One thread is being measured, the one that
+ * runs the game, so everything is static.
+ *********************************************/
+class PerfCounters
+{
+public:
+   // open what counters we can and sample every interval frames.
+   // Returns false if not one counter could be opened
+   static bool start(int interval);
+   static void stop();
+
+   // forget the samples so far, to start measuring something new
+   static void reset();
+
+   // did we get any counters at all?  this one?
+   static bool isAvailable() { return available; }
+   static bool isCounterAvailable(int counter);
+
+   // decide whether this frame is one we measure
+   static void beginFrame();
+
+   // bracket a phase.  Entities is how much there was to work on
+   static void begin(int phase);
+   static void end(int phase, long long entities);
+
+   // the latest sample and everything so far
+   static const PerfSample & getLast(int phase);
+   static const PerfSample & getTotal(int phase);
+
+   // instructions per cycle, and a counter per entity, 0 if unknown
+   static double getIpc(const PerfSample & sample);
+   static double getPerEntity(const PerfSample & sample, int counter);
+
+   static const char * phaseName(int phase);
+   static const char * counterName(int counter);
+
+   // the totals as a JSON object
+   static void writeJson(std::ostream & out);
+
+private:
+   static bool available;
+   static bool sampling;   // measuring this frame
+};
+
+#endif // PERF_COUNTERS_H
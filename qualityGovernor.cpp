@@ -0,0 +1,136 @@
+/***********************************************************************
+ * Source File:
+ *    Quality Governor : give up eye candy before giving up frames
+ * Summary:
+ *    Quick to back off and slow to recover.  A frame far past the budget
+ *    steps down at once, a few merely late frames in a row do too, and it
+ *    takes a full second of easy frames to step back up.  That way one
+ *    big explosion is absorbed right away without the quality bouncing
+ *    up and down every other frame.
+ ************************************************************************/
+
+#include "qualityGovernor.h"
+#include "levelOfDetail.h"
+
+#define QUALITY_OVER_FRAMES   3    // late frames before stepping down
+#define QUALITY_UNDER_FRAMES  30   // easy frames before stepping up
+#define QUALITY_SPIKE_PERCENT 150  // this far past budget steps at once
+
+/*********************************************
+ * QUALITY STEPS
+ * From everything on to the bare minimum.  Each
+ * level roughly halves the cosmetic work.
+ *********************************************/
+static const QualityStep steps[QUALITY_WORST + 1] =
+{
+   // debris  trail  stars  sprites  detail
+   {  1,      1,     1,     true,    0 },
+   {  2,      2,     1,     true,    0 },
+   {  4,      4,     2,     false,   1 },
+   {  8,      8,     4,     false,   2 },
+   {  16,     0,     8,     false,   3 },
+};
+
+int  QualityGovernor::level       = QUALITY_BEST;
+bool QualityGovernor::pinned      = false;
+int  QualityGovernor::overFrames  = 0;
+int  QualityGovernor::underFrames = 0;
+
+/******************************************************************
+ * QUALITY GOVERNOR : UPDATE
+ * Step down on a spike or a run of late frames; step up after a
+ * long run of frames using less than half the budget.
+ *   INPUT  workNs     how long the last frame's work took
+ *          budgetNs   how long we can afford per frame
+ ****************************************************************/
+void QualityGovernor::update(long long workNs, long long budgetNs)
+{
+   if (pinned)
+      return;
+
+   if (workNs > budgetNs * QUALITY_SPIKE_PERCENT / 100)
+   {
+      underFrames = 0;
+      overFrames  = 0;
+      setLevel(level + 1);
+   }
+   else if (workNs > budgetNs)
+   {
+      underFrames = 0;
+      if (++overFrames >= QUALITY_OVER_FRAMES)
+      {
+         setLevel(level + 1);
+         overFrames = 0;
+      }
+   }
+   else if (workNs < budgetNs / 2)
+   {
+      overFrames = 0;
+      if (++underFrames >= QUALITY_UNDER_FRAMES)
+      {
+         setLevel(level - 1);
+         underFrames = 0;
+      }
+   }
+   else
+   {
+      overFrames  = 0;
+      underFrames = 0;
+   }
+}
+
+/******************************************************************
+ * QUALITY GOVERNOR : PIN
+ *   INPUT  level   QUALITY_BEST .. QUALITY_WORST, or negative to adapt
+ ****************************************************************/
+void QualityGovernor::pin(int level)
+{
+   pinned = (level >= 0);
+   setLevel(pinned ? level : QUALITY_BEST);
+}
+
+/******************************************************************
+ * QUALITY GOVERNOR : SET LEVEL
+ * Keep the level in range and tell the rocks how detailed to be
+ ****************************************************************/
+void QualityGovernor::setLevel(int level)
+{
+   if (level < QUALITY_BEST)
+      level = QUALITY_BEST;
+   if (level > QUALITY_WORST)
+      level = QUALITY_WORST;
+   QualityGovernor::level = level;
+   LevelOfDetail::setBias(steps[level].detailBias);
+}
+
+/******************************************************************
+ * QUALITY GOVERNOR : GET STEP
+ ****************************************************************/
+const QualityStep & QualityGovernor::getStep()
+{
+   return steps[level];
+}
+
+/******************************************************************
+ * QUALITY GOVERNOR : DEBRIS COUNT
+ * Every explosion still makes at least one particle so it is
+ * never invisible.
+ *   INPUT  full       how many particles at the best quality
+ *   OUTPUT <return>   how many to make now
+ ****************************************************************/
+int QualityGovernor::debrisCount(int full)
+{
+   int count = full / steps[level].debrisDivisor;
+   return count > 0 ? count : 1;
+}
+
+/******************************************************************
+ * QUALITY GOVERNOR : IS TRAIL TICK
+ *   INPUT  tick       counts up once per ship advance
+ *   OUTPUT <return>   true if a trail particle goes out this tick
+ ****************************************************************/
+bool QualityGovernor::isTrailTick(int tick)
+{
+   int interval = steps[level].trailInterval;
+   return interval > 0 && tick % interval == 0;
+}
@@ -0,0 +1,75 @@
+/***********************************************************************
+ * Header File:
+ *    Quality Governor : give up eye candy before giving up frames
+ * Summary:
+ *    When a lot of rocks break at once the explosions can make a frame
+ *    run past its deadline, and the input lag follows.  The governor
+ *    watches how long each frame's work takes and, one step at a time,
+ *    turns down the things that are only there to look nice: debris per
+ *    explosion, the ship's trail, the background stars, the fancy
+ *    weapons and the detail on the rocks.  Nothing that can hit
+ *    anything is touched, so the game plays the same at every level.
+ ************************************************************************/
+
+#ifndef QUALITY_GOVERNOR_H
+#define QUALITY_GOVERNOR_H
+
+#define QUALITY_BEST   0   // everything on: the game as it always was
+#define QUALITY_WORST  4   // the least we will draw
+
+/*********************************************
+ * QUALITY STEP
+ * What one level of quality allows
+ *********************************************/
+struct QualityStep
+{
+   int  debrisDivisor;   // divide the debris per explosion by this
+   int  trailInterval;   // emit a trail particle every this many ticks,
+                         //    0 for no trail at all
+   int  starDivisor;     // draw one star out of this many
+   bool spriteWeapons;   // birds, numbers and pizza, or just dots
+   int  detailBias;      // handed to LevelOfDetail::setBias()
+};
+
+/*********************************************
+ * QUALITY GOVERNOR
+ * Global, like the frame it is protecting
+ *********************************************/
+class QualityGovernor
+{
+public:
+   // look at how long the last frame took against what we can afford
+   // and step the quality up or down
+   static void update(long long workNs, long long budgetNs);
+
+   // hold the quality at one level and stop adapting.  A negative level
+   // lets the governor adapt again
+   static void pin(int level);
+
+   static int getLevel() { return level; }
+
+   // the rules at the current level
+   static const QualityStep & getStep();
+
+   // how many debris particles an explosion of this many should make
+   static int debrisCount(int full);
+
+   // should the trail get a particle on this tick?
+   static bool isTrailTick(int tick);
+
+   // should the n-th star we come across be drawn?
+   static bool isStarDrawn(int n) { return n % getStep().starDivisor == 0; }
+
+   // draw weapons as sprites, or as plain dots?
+   static bool isSpriteWeapons() { return getStep().spriteWeapons; }
+
+private:
+   static void setLevel(int level);
+
+   static int  level;        // QUALITY_BEST .. QUALITY_WORST
+   static bool pinned;       // the user chose the level
+   static int  overFrames;   // frames in a row over the budget
+   static int  underFrames;  // frames in a row comfortably under it
+};
+
+#endif // QUALITY_GOVERNOR_H
@@ -0,0 +1,397 @@
+/***********************************************************************
+ * Source File:
+ *    Replay : a recorded game, to play back from anywhere
+ * Summary:
+ *    Recording is ordinary buffered writes; the keyframes are what
+ *    Game::saveState() gives, the same thing rollback keeps.  Reading
+ *    maps the whole file and works straight out of the map: finding a
+ *    keyframe is a binary search of the index, and loading one is three
+ *    array copies.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>        // for open()
+#include <unistd.h>       // for close()
+#include <sys/mman.h>     // for mmap()
+#include <sys/stat.h>     // for fstat()
+#endif // _WIN32
+
+#include "replay.h"
+#include "game.h"
+#include "simRandom.h"
+
+using namespace std;
+
+FILE *       ReplayRecorder::pFile = NULL;
+const Game * ReplayRecorder::pGame = NULL;
+int          ReplayRecorder::work   = 0;
+int          ReplayRecorder::since  = 0;
+
+static ReplayHeader        recording;   // filled in as we go
+static vector<ReplayIndex> keyframes;
+static GameState           saved;
+static unsigned long long  written;     // bytes so far
+
+/******************************************************************
+ * WRITE
+ ****************************************************************/
+static void write(FILE * pFile, const void * data, size_t bytes)
+{
+   if (bytes > 0)
+      fwrite(data, 1, bytes, pFile);
+   written += bytes;
+}
+
+/******************************************************************
+ * PAD
+ * Up to a multiple of 8, so everything in the map is aligned
+ ****************************************************************/
+static void pad(FILE * pFile)
+{
+   static const unsigned char zeros[8] = { 0 };
+   write(pFile, zeros, (8 - written % 8) % 8);
+}
+
+/******************************************************************
+ * REPLAY RECORDER : START
+ * The header goes in now to hold the place, and again at the end
+ * once we know how it all came out
+ ****************************************************************/
+bool ReplayRecorder::start(const char * path, unsigned int seed, float world,
+                           int rocks, int humans, int bots,
+                           int botDifficulty, int botAggression)
+{
+   assert(!isActive());
+   assert(humans > 0 && humans <= REPLAY_MAX_HUMANS);
+   pFile = fopen(path, "wb");
+   if (!pFile)
+      return false;
+
+   recording.magic         = REPLAY_MAGIC;
+   recording.version       = REPLAY_VERSION;
+   recording.seed          = seed;
+   recording.world         = world;
+   recording.rocks         = rocks;
+   recording.humans        = humans;
+   recording.bots          = bots;
+   recording.botDifficulty = botDifficulty;
+   recording.botAggression = botAggression;
+   recording.ticks         = 0;
+   recording.keyframes     = 0;
+   recording.interval      = REPLAY_KEYFRAME;
+   recording.index         = 0;
+   recording.hash          = 0;
+   keyframes.clear();
+   written = 0;
+   pGame   = NULL;
+   work    = 0;
+   since   = 0;
+   write(pFile, &recording, sizeof(recording));
+   return true;
+}
+
+/******************************************************************
+ * REPLAY RECORDER : RECORD
+ * Only what the simulation holds decides where the keyframes go, so
+ * the file does not depend on how fast this machine is
+ ****************************************************************/
+void ReplayRecorder::record(const Game & game, const int keys[])
+{
+   if (!isActive())
+      return;
+   pGame = &game;
+
+   if (recording.ticks == 0 || since >= REPLAY_KEYFRAME ||
+       work >= REPLAY_KEYFRAME_WORK)
+   {
+      work  = 0;
+      since = 0;
+      pad(pFile);
+      ReplayIndex entry;
+      entry.tick     = recording.ticks;
+      entry.reserved = 0;
+      entry.offset   = written;
+      keyframes.push_back(entry);
+
+      game.saveState(saved);
+      ReplayKeyframe keyframe;
+      keyframe.tick    = recording.ticks;
+      keyframe.ships   = (unsigned int)saved.ships.size();
+      keyframe.rocks   = (unsigned int)saved.rocks.size();
+      keyframe.bullets = (unsigned int)saved.bullets.size();
+      keyframe.random  = saved.random;
+      keyframe.nextId  = saved.nextId;
+      keyframe.reserved = 0;
+      write(pFile, &keyframe, sizeof(keyframe));
+      write(pFile, saved.ships.data(),   saved.ships.size()   * sizeof(ShipState));
+      write(pFile, saved.rocks.data(),   saved.rocks.size()   * sizeof(RockState));
+      write(pFile, saved.bullets.data(), saved.bullets.size() * sizeof(BulletState));
+   }
+
+   unsigned char bytes[REPLAY_MAX_HUMANS];
+   for (int i = 0; i < recording.humans; i++)
+      bytes[i] = (unsigned char)keys[i];
+   write(pFile, bytes, recording.humans);
+   recording.ticks++;
+   since++;
+   work += REPLAY_TICK_WORK + game.getSimulatedCount();
+}
+
+/******************************************************************
+ * REPLAY RECORDER : STOP
+ ****************************************************************/
+void ReplayRecorder::stop()
+{
+   if (!isActive())
+      return;
+   pad(pFile);
+   recording.index     = written;
+   recording.keyframes = (int)keyframes.size();
+   recording.hash      = pGame ? pGame->getStateHash() : 0;
+   write(pFile, keyframes.data(), keyframes.size() * sizeof(ReplayIndex));
+   fseek(pFile, 0, SEEK_SET);
+   fwrite(&recording, sizeof(recording), 1, pFile);
+   fclose(pFile);
+   pFile = NULL;
+   pGame = NULL;
+}
+
+/******************************************************************
+ * REPLAY READER : CONSTRUCTOR
+ ****************************************************************/
+ReplayReader::ReplayReader() : pHeader(NULL), pIndex(NULL), size(0),
+                               keyframe(0), tick(0), pKeys(NULL)
+{
+}
+
+/******************************************************************
+ * REPLAY READER : OPEN
+ * Everything the header says is checked against the size of the
+ * file, so a bad one is turned away here rather than read past
+ ****************************************************************/
+bool ReplayReader::open(const char * path)
+{
+   assert(!isOpen());
+   const void * memory = NULL;
+   long long bytes = 0;
+
+#ifdef _WIN32
+   HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, NULL,
+                             OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+   if (file == INVALID_HANDLE_VALUE)
+      return false;
+   LARGE_INTEGER length;
+   if (!GetFileSizeEx(file, &length) || length.QuadPart < (LONGLONG)sizeof(ReplayHeader))
+   {
+      CloseHandle(file);
+      return false;
+   }
+   bytes = length.QuadPart;
+   HANDLE mapping = CreateFileMappingA(file, NULL, PAGE_READONLY, 0, 0, NULL);
+   CloseHandle(file);
+   if (mapping == NULL)
+      return false;
+   memory = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+   CloseHandle(mapping);              // the view keeps it alive
+   if (memory == NULL)
+      return false;
+#else
+   int fd = ::open(path, O_RDONLY);
+   if (fd < 0)
+      return false;
+   struct stat status;
+   if (fstat(fd, &status) != 0 || status.st_size < (off_t)sizeof(ReplayHeader))
+   {
+      ::close(fd);
+      return false;
+   }
+   bytes = status.st_size;
+   memory = mmap(NULL, bytes, PROT_READ, MAP_SHARED, fd, 0);
+   ::close(fd);
+   if (memory == MAP_FAILED)
+      return false;
+#endif // _WIN32
+
+   pHeader = (const ReplayHeader *)memory;
+   size    = bytes;
+   const ReplayHeader & h = *pHeader;
+   bool ok = h.magic == REPLAY_MAGIC && h.version == REPLAY_VERSION &&
+             h.humans > 0 && h.humans <= REPLAY_MAX_HUMANS &&
+             h.ticks >= 0 && h.keyframes > 0 && h.index % 8 == 0 &&
+             h.index <= (unsigned long long)size &&
+             (unsigned long long)h.keyframes <=
+                ((unsigned long long)size - h.index) / sizeof(ReplayIndex);
+   if (ok)
+   {
+      pIndex = (const ReplayIndex *)((const char *)memory + h.index);
+      for (int i = 0; i < h.keyframes && ok; i++)
+         ok = pIndex[i].offset % 8 == 0 && pIndex[i].offset < h.index &&
+              (i == 0 ? pIndex[i].tick == 0
+                      : pIndex[i].tick > pIndex[i - 1].tick &&
+                        pIndex[i].tick - pIndex[i - 1].tick <= h.interval);
+   }
+   if (!ok)
+   {
+      close();
+      return false;
+   }
+   keyframe = 0;
+   tick     = 0;
+   pKeys    = NULL;
+   return true;
+}
+
+/******************************************************************
+ * REPLAY READER : CLOSE
+ ****************************************************************/
+void ReplayReader::close()
+{
+   if (!isOpen())
+      return;
+#ifdef _WIN32
+   UnmapViewOfFile(pHeader);
+#else
+   munmap((void *)pHeader, size);
+#endif // _WIN32
+   pHeader = NULL;
+   pIndex  = NULL;
+   size    = 0;
+   pKeys   = NULL;
+}
+
+/******************************************************************
+ * REPLAY READER : CREATE GAME
+ * The same players the recording had.  Where everything is does
+ * not matter, the first keyframe says that
+ ****************************************************************/
+Game * ReplayReader::createGame() const
+{
+   assert(isOpen());
+   SimRandom::seed(pHeader->seed);
+   float world = pHeader->world;
+   Game * pGame = new Game(Point(-world, world), Point(world, -world),
+                           pHeader->rocks);
+   for (int i = 1; i < pHeader->humans; i++)
+      pGame->addPlayer(Point(World::getXMax() / 2, 0));
+   pGame->addBots(pHeader->bots, pHeader->botDifficulty,
+                  pHeader->botAggression);
+   return pGame;
+}
+
+/******************************************************************
+ * REPLAY READER : FIND KEYFRAME
+ * The last one at or before the tick
+ ****************************************************************/
+const ReplayIndex * ReplayReader::findKeyframe(int tick) const
+{
+   int low  = 0;
+   int high = pHeader->keyframes;
+   while (high - low > 1)
+   {
+      int middle = (low + high) / 2;
+      if (pIndex[middle].tick <= tick)
+         low = middle;
+      else
+         high = middle;
+   }
+   return &pIndex[low];
+}
+
+/******************************************************************
+ * REPLAY READER : READ CHUNK
+ ****************************************************************/
+const unsigned char * ReplayReader::readChunk(int keyframe,
+                                              GameState * pState) const
+{
+   const char * base = (const char *)pHeader;
+   unsigned long long at = pIndex[keyframe].offset;
+   if (at + sizeof(ReplayKeyframe) > pHeader->index)
+      return NULL;
+   const ReplayKeyframe & k = *(const ReplayKeyframe *)(base + at);
+   at += sizeof(ReplayKeyframe);
+
+   const ShipState * pShips = (const ShipState *)(base + at);
+   at += (unsigned long long)k.ships * sizeof(ShipState);
+   const RockState * pRocks = (const RockState *)(base + at);
+   at += (unsigned long long)k.rocks * sizeof(RockState);
+   const BulletState * pBullets = (const BulletState *)(base + at);
+   at += (unsigned long long)k.bullets * sizeof(BulletState);
+
+   // and all of the chunk's keys after that
+   int next = keyframe + 1 < pHeader->keyframes ? pIndex[keyframe + 1].tick
+                                                : pHeader->ticks;
+   if (k.tick != pIndex[keyframe].tick || next < k.tick ||
+       at + (unsigned long long)(next - k.tick) * pHeader->humans > pHeader->index)
+      return NULL;
+
+   if (pState)
+   {
+      pState->ships.assign(pShips, pShips + k.ships);
+      pState->rocks.assign(pRocks, pRocks + k.rocks);
+      pState->bullets.assign(pBullets, pBullets + k.bullets);
+      pState->random = k.random;
+      pState->nextId = k.nextId;
+   }
+   return (const unsigned char *)(base + at);
+}
+
+/******************************************************************
+ * REPLAY READER : SEEK
+ ****************************************************************/
+bool ReplayReader::seek(Game & game, int tick)
+{
+   assert(isOpen());
+   if (tick < 0 || tick > pHeader->ticks)
+      return false;
+
+   const ReplayIndex * pFound = findKeyframe(tick);
+   int found = (int)(pFound - pIndex);
+   const unsigned char * pStart = readChunk(found, &state);
+   if (!pStart || state.ships.size() != (size_t)game.getPlayerCount())
+      return false;
+   game.loadState(state);
+   keyframe  = found;
+   this->tick = pFound->tick;
+   pKeys     = pStart;
+
+   // the eye candy for ticks we skip past is not worth making
+   game.setResimulating(true);
+   while (this->tick < tick)
+      step(game);
+   game.setResimulating(false);
+   return true;
+}
+
+/******************************************************************
+ * REPLAY READER : STEP
+ * Moving into the next chunk only means finding its keys: the
+ * game we have played to there is already what its keyframe says
+ ****************************************************************/
+bool ReplayReader::step(Game & game)
+{
+   assert(isOpen());
+   if (!pKeys || tick >= pHeader->ticks)
+      return false;
+   if (keyframe + 1 < pHeader->keyframes && pIndex[keyframe + 1].tick == tick)
+   {
+      const unsigned char * pNext = readChunk(keyframe + 1, NULL);
+      if (!pNext)
+         return false;
+      keyframe++;
+      pKeys = pNext;
+   }
+
+   int keys[REPLAY_MAX_HUMANS];
+   for (int i = 0; i < pHeader->humans; i++)
+      keys[i] = pKeys[i];
+   pKeys += pHeader->humans;
+   game.handleInput(keys, pHeader->humans);
+   game.advance();
+   tick++;
+   return true;
+}
@@ -0,0 +1,189 @@
+/***********************************************************************
+ * Header File:
+ *    Replay : a recorded game, to play back from anywhere
+ * Summary:
+ *    The game is deterministic, so the keys pressed each tick are all
+ *    it takes to play a session again.  Playing from the start to get
+ *    to minute 40 takes far too long, though, so every so often the
+ *    whole simulation goes in as well, a keyframe.  To get to a tick
+ *    we load the keyframe at or before it and play only the few ticks
+ *    in between.  A keyframe goes in every REPLAY_KEYFRAME ticks, or
+ *    sooner when the ticks since the last one add up to
+ *    REPLAY_KEYFRAME_WORK: each costs REPLAY_TICK_WORK, plus one for
+ *    every ship, rock and bullet in play.  That follows what a tick
+ *    costs closely enough that a seek never has much to play again
+ *    however busy the game was, and the same session always makes
+ *    the same file.
+ *
+ *    The file is read through a memory map, so opening even an hour of
+ *    play reads nothing until it is needed, and is laid out like so:
+ *
+ *       header      ReplayHeader: how to set the game up, how long it
+ *                   runs and where the index is
+ *       chunks      one per keyframe: a ReplayKeyframe, the ships,
+ *                   rocks and bullets as GameState keeps them, then
+ *                   one byte of keys per human player for each tick up
+ *                   to the next keyframe, padded to 8 bytes
+ *       index       a ReplayIndex for each keyframe, in order of tick
+ *
+ *    Everything is in the recording machine's byte order.  The index
+ *    is written last, so a recording cut off before then cannot be
+ *    read.
+ ************************************************************************/
+
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <cstdio>
+#include <cstddef>    // for NULL
+#include "gameState.h"
+
+class Game;
+
+#define REPLAY_MAGIC      0x41535250   // "ASRP"
+#define REPLAY_VERSION    2
+#define REPLAY_KEYFRAME   60           // most ticks between keyframes
+#define REPLAY_TICK_WORK     40        // a tick's own cost, in entities
+#define REPLAY_KEYFRAME_WORK 420       // most play between keyframes
+#define REPLAY_MAX_HUMANS 16
+
+/*********************************************
+ * REPLAY HEADER
+ * The start of the file: what the game was
+ * started with, and what it came to
+ *********************************************/
+struct ReplayHeader
+{
+   unsigned int       magic;           // REPLAY_MAGIC
+   unsigned int       version;         // REPLAY_VERSION
+   unsigned int       seed;
+   float              world;           // half the arena's width
+   int                rocks;           // big rocks to start with
+   int                humans;          // players whose keys are recorded
+   int                bots;
+   int                botDifficulty;
+   int                botAggression;
+   int                ticks;           // recorded
+   int                keyframes;
+   int                interval;        // most ticks between keyframes
+   unsigned long long index;           // where the index starts
+   unsigned long long hash;            // the game's state after the last tick
+};
+
+/*********************************************
+ * REPLAY KEYFRAME
+ * The start of a chunk: the simulation before
+ * this tick was played
+ *********************************************/
+struct ReplayKeyframe
+{
+   int                tick;
+   unsigned int       ships;
+   unsigned int       rocks;
+   unsigned int       bullets;
+   unsigned long long random;          // SimRandom's state
+   unsigned int       nextId;          // the next id to hand out
+   unsigned int       reserved;
+};
+
+/*********************************************
+ * REPLAY INDEX
+ * Where a keyframe's chunk starts
+ *********************************************/
+struct ReplayIndex
+{
+   int                tick;
+   unsigned int       reserved;
+   unsigned long long offset;
+};
+
+static_assert(sizeof(ReplayHeader) == 64, "the header layout is fixed");
+static_assert(sizeof(ReplayKeyframe) == 32, "the keyframe layout is fixed");
+static_assert(sizeof(ReplayIndex) == 16, "the index layout is fixed");
+static_assert(sizeof(ShipState) == 40 && sizeof(RockState) == 36 &&
+              sizeof(BulletState) == 44, "keyframes are written with no padding");
+
+/*********************************************
+ * REPLAY RECORDER
+ * There is one game being played, so
+ * everything is static.  Only the game
+ * thread records
+ *********************************************/
+class ReplayRecorder
+{
+public:
+   // start a recording of a game set up like this.  False if the file
+   // cannot be made
+   static bool start(const char * path, unsigned int seed, float world,
+                     int rocks, int humans, int bots, int botDifficulty,
+                     int botAggression);
+
+   // finish the file off with the index and how the game ended.  Safe
+   // from atexit()
+   static void stop();
+
+   static bool isActive() { return pFile != NULL; }
+
+   // before each tick: the keys the humans are about to play it with.
+   // The game goes in too every REPLAY_KEYFRAME ticks, or sooner once
+   // the work since the last keyframe reaches REPLAY_KEYFRAME_WORK
+   static void record(const Game & game, const int keys[]);
+
+private:
+   static FILE *       pFile;
+   static const Game * pGame;     // for the hash at the end
+   static int          work;      // to play since the last keyframe
+   static int          since;     // and ticks
+};
+
+/*********************************************
+ * REPLAY READER
+ * A recording, mapped, and where we are in it.
+ * There can be as many as we like
+ *********************************************/
+class ReplayReader
+{
+public:
+   ReplayReader();
+   ~ReplayReader() { close(); }
+
+   // map a recording.  False if it is not one, or was cut off
+   bool open(const char * path);
+   void close();
+
+   bool isOpen() const { return pHeader != NULL; }
+   const ReplayHeader & getHeader() const { return *pHeader; }
+   long long getBytes() const { return size; }
+
+   // a game set up the way the recorded one was.  The caller deletes it
+   Game * createGame() const;
+
+   // put the game at this tick, 0 to getHeader().ticks: the keyframe
+   // at or before it, and the ticks in between played over without the
+   // eye candy.  False if there is no such tick
+   bool seek(Game & game, int tick);
+
+   // play the next tick.  False at the end
+   bool step(Game & game);
+
+   // the next tick step() plays
+   int getTick() const { return tick; }
+
+private:
+   const ReplayIndex * findKeyframe(int tick) const;
+
+   // where a chunk's keys start, copying its keyframe out if asked.
+   // NULL if the chunk runs off the end of the file
+   const unsigned char * readChunk(int keyframe, GameState * pState) const;
+
+   const ReplayHeader *  pHeader;     // the start of the map
+   const ReplayIndex *   pIndex;
+   long long             size;
+
+   int                   keyframe;    // whose chunk we are in
+   int                   tick;
+   const unsigned char * pKeys;       // for this tick
+   GameState             state;       // to load keyframes through
+};
+
+#endif // REPLAY_H
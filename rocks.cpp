@@ -1,19 +1,106 @@
 #include "rocks.h"
+#include "world.h"
+#include "eventBus.h"
 
 using namespace std;
 
 /***************************************
-* GAME :: ADVANCE
-* defualt advance function
+* ADVANCE TIER
+* spin and move a rock of this tier.  The
+* spin is a constant in each copy.
 ***************************************/
-void Rocks::advance()
+template <int TIER>
+static void advanceTier(Rocks & rock)
 {
+   const int spin = ROCK_TIERS[TIER].spin;
+   rock.setRotation(rock.getRotation() + (rock.getDirection() ? spin : -spin));
+   rock.globalAdvance();
+}
 
+/***************************************
+* DRAW TIER
+***************************************/
+template <int TIER>
+static void drawTier(const Rocks & rock)
+{
+   drawAsteroid(ROCK_TIERS[TIER].mesh, rock.getPosition(), rock.getRotation(),
+                LevelOfDetail::select(ROCK_TIERS[TIER].size));
 }
 
 /***************************************
-* GAME :: GLOBALADVANCE
-* a function that any inherited class will use
+* BREAK APART TIER
+* add the pieces a rock of this tier breaks
+* into.  Each piece keeps the parent's
+* heading and gets its push on top of the
+* parent's velocity.
+***************************************/
+template <int TIER>
+static void breakApartTier(const Rocks & rock, list<Rocks*>& rocks)
+{
+   for (int i = 0; i < ROCK_TIERS[TIER].children; i++)
+   {
+      const RockChild & child = ROCK_TIERS[TIER].child[i];
+      Rocks *pRock = new Rocks(child.tier, rock.getPosition());
+      pRock->setVelocity(Velocity(Point(rock.getVelocity().getDx() + child.dx,
+                                        rock.getVelocity().getDy() + child.dy)));
+      pRock->setAngle(rock.getAngle());
+      rocks.push_back(pRock);
+      EventBus::publish(EVENT_ROCK_SPAWNED, pRock->getPosition(), child.tier);
+   }
+}
+
+/***************************************
+* TIER DISPATCH
+* walk the tiers at compile time until we
+* reach the rock's, then call that tier's
+* copy of the kernel.  This turns into a
+* plain chain of compares.
+***************************************/
+template <int TIER>
+struct TierDispatch
+{
+   static void advance(Rocks & rock)
+   {
+      if (rock.getTier() == TIER)
+         advanceTier<TIER>(rock);
+      else
+         TierDispatch<TIER + 1>::advance(rock);
+   }
+   static void draw(const Rocks & rock)
+   {
+      if (rock.getTier() == TIER)
+         drawTier<TIER>(rock);
+      else
+         TierDispatch<TIER + 1>::draw(rock);
+   }
+   static void breakApart(const Rocks & rock, list<Rocks*>& rocks)
+   {
+      if (rock.getTier() == TIER)
+         breakApartTier<TIER>(rock, rocks);
+      else
+         TierDispatch<TIER + 1>::breakApart(rock, rocks);
+   }
+};
+
+template <>
+struct TierDispatch<ROCK_TIER_COUNT>
+{
+   static void advance(Rocks &) {}
+   static void draw(const Rocks &) {}
+   static void breakApart(const Rocks &, list<Rocks*>&) {}
+};
+
+/***************************************
+* ROCKS :: ADVANCE
+***************************************/
+void Rocks::advance()
+{
+   TierDispatch<0>::advance(*this);
+}
+
+/***************************************
+* ROCKS :: GLOBALADVANCE
+* movement shared by every tier
 ***************************************/
 void Rocks::globalAdvance()
 {
@@ -23,43 +110,26 @@ void Rocks::globalAdvance()
 		setRotation(360);
 	float x = getPosition().getX() + getVelocity().getDx() * cos((getAngle() + 90) * PI / 180);
 	float y = getPosition().getY() + getVelocity().getDy() * sin((getAngle() + 90) * PI / 180);
-	if (x < -200 - getSize())
-	{
-		x = 200 + getSize();
-		y = y * -1;
-	}
-	else if (x > 200 + getSize())
-	{
-		x = -200 - getSize();
-		y = y * -1;
-	}
-	if (y < -200 - getSize())
-	{
-		y = 200 + getSize();
-		x = x * -1;
-	}
-	else if (y > 200 + getSize())
-	{
-		y = -200 - getSize();
-		x = x * -1;
-	}
+	// rocks come back in on the far side, mirrored across the middle
+	if (World::wrapX(x, getSize()))
+		y = World::getYMin() + World::getYMax() - y;
+	if (World::wrapY(y, getSize()))
+		x = World::getXMin() + World::getXMax() - x;
 	setPosition(Point(x, y));
 }
 
 /***************************************
-* GAME :: DRAW
-* default draw function
+* ROCKS :: DRAW
 ***************************************/
-void Rocks::draw()
+void Rocks::draw() const
 {
-
+   TierDispatch<0>::draw(*this);
 }
 
 /***************************************
-* GAME :: BREAKAPART
-* default break apart function
+* ROCKS :: BREAKAPART
 ***************************************/
-void Rocks::breakApart(list<Rocks*>& rocks)
+void Rocks::breakApart(list<Rocks*>& rocks) const
 {
-
-}
\ No newline at end of file
+   TierDispatch<0>::breakApart(*this, rocks);
+}
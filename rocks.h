@@ -9,17 +9,89 @@
 #define MEDIUM_ROCK_SPIN 5
 #define SMALL_ROCK_SPIN 10
 
+#define BIG_ROCK_POINTS    20
+#define MEDIUM_ROCK_POINTS 50
+#define SMALL_ROCK_POINTS  100
+
 #include <list>
 #include "flyingObject.h"
+#include "levelOfDetail.h"
+#include "simRandom.h"
+
+/*************************************************************
+ * ROCK TIERS
+ * Every kind of rock is a row in ROCK_TIERS.  A tier says how
+ * big the rock is, how fast it spins, what it looks like, what
+ * it is worth and what it breaks into.  Each child is another
+ * tier with a push added to the parent's velocity.  Deeper
+ * fragmentation chains are just more rows.
+ *************************************************************/
+#define ROCK_BIG          0
+#define ROCK_MEDIUM       1
+#define ROCK_SMALL        2
+#define ROCK_TIER_COUNT   3
+#define ROCK_MAX_CHILDREN 4
 
+struct RockChild
+{
+   int   tier;   // what the piece is
+   float dx;     // added to the parent's velocity
+   float dy;
+};
+
+struct RockTier
+{
+   int       size;       // radius for collisions
+   int       spin;       // degrees per tick
+   int       mesh;       // MESH_*_ROCK
+   int       points;     // score for shooting it
+   int       children;   // how many pieces it breaks into
+   RockChild child[ROCK_MAX_CHILDREN];
+};
+
+constexpr RockTier ROCK_TIERS[ROCK_TIER_COUNT] =
+{
+   // ROCK_BIG
+   { BIG_ROCK_SIZE,    BIG_ROCK_SPIN,    MESH_LARGE_ROCK,  BIG_ROCK_POINTS,
+     3, { { ROCK_MEDIUM, 0.0,  1.0 },
+          { ROCK_MEDIUM, 0.0, -1.0 },
+          { ROCK_SMALL,  2.0,  0.0 } } },
+   // ROCK_MEDIUM
+   { MEDIUM_ROCK_SIZE, MEDIUM_ROCK_SPIN, MESH_MEDIUM_ROCK, MEDIUM_ROCK_POINTS,
+     2, { { ROCK_SMALL,  3.0,  0.0 },
+          { ROCK_SMALL, -3.0,  0.0 } } },
+   // ROCK_SMALL
+   { SMALL_ROCK_SIZE,  SMALL_ROCK_SPIN,  MESH_SMALL_ROCK,  SMALL_ROCK_POINTS,
+     0, { } }
+};
+
+/*************************************************************
+ * ROCKS
+ * One class for every tier.  Nothing is virtual: advance(),
+ * draw() and breakApart() pick the code for the rock's tier,
+ * and that code is compiled separately for each row of the
+ * table so the tier's numbers are constants inside it.
+ *************************************************************/
 class Rocks : public FlyingObject
 {
   public:
-  Rocks() : direction(random(0, 1)), angle(random(0, 360)), collision(false) { setVelocity(Velocity(Point(1, 1))); }
-   virtual void advance();
+   Rocks(int tier = ROCK_SMALL) : direction(SimRandom::next(0, 1)),
+                                  angle(SimRandom::next(0, 360)),
+                                  collision(false), tier(tier)
+   {
+      setVelocity(Velocity(Point(1, 1)));
+      setSize(ROCK_TIERS[tier].size);
+   }
+   Rocks(int tier, Point pos) : Rocks(tier) { setPosition(pos); }
+
+   void advance();
    void globalAdvance();
-   virtual void draw();
-   virtual void breakApart(std::list<Rocks*>& rocks);
+   void draw() const;
+   void breakApart(std::list<Rocks*>& rocks) const;
+
+   int getTier() const { return tier; }
+   void setTier(int tier) { this->tier = tier; setSize(ROCK_TIERS[tier].size); }
+   int getPoints() const { return ROCK_TIERS[tier].points; }
    bool getDirection() const { return direction; }
    void setDirection(bool dir) { direction = dir; }
    int getAngle() const { return angle; }
@@ -30,89 +102,7 @@ class Rocks : public FlyingObject
    bool direction;
    int angle;
    bool collision;
-};
-
-class SmallRock : public Rocks
-{
-  public:
-   SmallRock(Point pos) { setPosition(pos); setSize(SMALL_ROCK_SIZE); }
-      void advance()
-         {
-            setRotation(getRotation() + (getDirection() ? SMALL_ROCK_SPIN : SMALL_ROCK_SPIN * -1));
-            globalAdvance();
-         }
-         void draw() {
-            drawSmallAsteroid(getPosition(), getRotation());
-         }
-         void breakApart(std::list<Rocks*>& rocks) {}
-};
-
-class MediumRock : public Rocks
-{
-  public:
-   MediumRock(Point pos) { setPosition(pos); setSize(MEDIUM_ROCK_SIZE); }
-   void advance()
-      {
-           setRotation(getRotation() + (getDirection() ? MEDIUM_ROCK_SPIN : MEDIUM_ROCK_SPIN * -1));
-           globalAdvance();
-	}
-      void draw() {
-         drawMediumAsteroid(getPosition(), getRotation());
-      }
-      void breakApart(std::list<Rocks*>& rocks)
-	{
-           for (int i = 0; i < 2; i++)
-           {
-                   Rocks *pRock = new SmallRock(getPosition());
-                   if (i == 0)
-                   {
-                           pRock->setVelocity(Velocity(Point(getVelocity().getDx() + 3, getVelocity().getDy())));
-			}
-                   else if (i == 1)
-			{
-                           pRock->setVelocity(Velocity(Point(getVelocity().getDx() - 3, getVelocity().getDy())));
-			}
-                   pRock->setAngle(getAngle());
-			rocks.push_back(pRock);
-		}
-	}
-};
-
-class BigRock : public Rocks
-{
-  public:
-   BigRock(Point pos) { setPosition(pos); setSize(BIG_ROCK_SIZE); }
-   void advance()
-      {
-         setRotation(getRotation() + (getDirection() ? BIG_ROCK_SPIN : BIG_ROCK_SPIN * -1));
-         globalAdvance();
-      }
-      void draw()
-	{
-           drawLargeAsteroid(getPosition(), getRotation());
-        }
-	void breakApart(std::list<Rocks*>& rocks)
-	{
-           for (int i = 0; i < 3; i++)
-           {
-			Rocks *pRock = new MediumRock(getPosition());
-			if (i == 0)
-			{
-                           pRock->setVelocity(Velocity(Point(getVelocity().getDx(), getVelocity().getDy() + 1)));
-			}
-			else if (i == 1)
-			{
-                           pRock->setVelocity(Velocity(Point(getVelocity().getDx(), getVelocity().getDy() - 1)));
-			}
-			else
-			{
-                           pRock = new SmallRock(getPosition());
-				pRock->setVelocity(Velocity(Point(getVelocity().getDx() + 2, getVelocity().getDy())));
-			}
-			pRock->setAngle(getAngle());
-			rocks.push_back(pRock);
-		}
-	}
+   int tier;
 };
 
 #endif /* rocks_h */
@@ -0,0 +1,146 @@
+/***********************************************************************
+ * Source File:
+ *    Rollback : play now, fix it later
+ * Summary:
+ *    For every tick not yet confirmed the ring holds the state just
+ *    before it, the peer's keys we played it with, and the hash after
+ *    it.  Slot t % ROLLBACK_RING is tick t; there are never more than
+ *    maxTicks of them, so nothing we still need is overwritten.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include "rollback.h"
+#include "lockstep.h"
+#include "game.h"
+#include "gameState.h"
+#include "frameTimer.h"   // for sleepFor()
+
+#define ROLLBACK_SETTLE_NS  1000000   // how long to nap waiting to settle
+
+bool Rollback::active      = false;
+int  Rollback::maxTicks    = ROLLBACK_DEFAULT_TICKS;
+int  Rollback::confirmed   = -1;
+int  Rollback::rollbacks   = 0;
+int  Rollback::resimulated = 0;
+int  Rollback::stalls      = 0;
+
+static GameState          states[ROLLBACK_RING];    // before each tick
+static unsigned char      guesses[ROLLBACK_RING];   // the peer's keys we used
+static unsigned long long hashes[ROLLBACK_RING];    // after each tick
+
+/******************************************************************
+ * ROLLBACK : START
+ ****************************************************************/
+void Rollback::start(int maxTicks)
+{
+   assert(Lockstep::isActive() && Lockstep::getTick() == 0);
+   assert(maxTicks > 0 && maxTicks <= ROLLBACK_MAX_TICKS);
+   Rollback::maxTicks = maxTicks;
+   confirmed   = -1;
+   rollbacks   = 0;
+   resimulated = 0;
+   stalls      = 0;
+   active      = true;
+}
+
+/******************************************************************
+ * ROLLBACK : STEP
+ ****************************************************************/
+bool Rollback::step(Game & game, int keys)
+{
+   assert(active);
+   Lockstep::poll();
+   reconcile(game);
+   if (Lockstep::isFailed())
+      return false;
+
+   // too far ahead of what we know: wait for the peer
+   int tick = Lockstep::getTick();
+   if (tick - confirmed > maxTicks)
+   {
+      stalls++;
+      return false;
+   }
+
+   int playerKeys[LOCKSTEP_PLAYERS];
+   Lockstep::predict(keys, playerKeys);
+   play(game, tick, playerKeys, false);
+   return true;
+}
+
+/******************************************************************
+ * ROLLBACK : SETTLE
+ * Wait until every tick played has the peer's real keys, fixing
+ * the last guesses, so both sides end on the same state
+ ****************************************************************/
+bool Rollback::settle(Game & game)
+{
+   assert(active);
+   while (confirmed < Lockstep::getTick() - 1 && !Lockstep::isFailed())
+   {
+      Lockstep::poll();
+      reconcile(game);
+      if (confirmed < Lockstep::getTick() - 1)
+         sleepFor(ROLLBACK_SETTLE_NS);
+   }
+   return !Lockstep::isFailed();
+}
+
+/******************************************************************
+ * ROLLBACK : RECONCILE
+ * Check our guesses against the keys that have come in.  If one
+ * was wrong, go back to just before it and play every tick since
+ * again.  Then the ticks we now know for sure are final, and their
+ * hashes can go to the peer.
+ ****************************************************************/
+void Rollback::reconcile(Game & game)
+{
+   int tick  = Lockstep::getTick();
+   int known = Lockstep::getConfirmed();
+   if (known > tick - 1)
+      known = tick - 1;
+   if (known <= confirmed)
+      return;
+
+   int wrong = -1;
+   for (int t = confirmed + 1; t <= known && wrong < 0; t++)
+      if (Lockstep::getRemoteKeys(t) != guesses[t % ROLLBACK_RING])
+         wrong = t;
+
+   if (wrong >= 0)
+   {
+      rollbacks++;
+      int side = Lockstep::getSide();
+      int newest = Lockstep::getConfirmed();
+      game.loadState(states[wrong % ROLLBACK_RING]);
+      game.setResimulating(true);
+      for (int t = wrong; t < tick; t++)
+      {
+         int playerKeys[LOCKSTEP_PLAYERS];
+         playerKeys[side]     = Lockstep::getLocalKeys(t);
+         playerKeys[1 - side] = Lockstep::getRemoteKeys(t <= newest ? t : newest);
+         play(game, t, playerKeys, true);
+      }
+      game.setResimulating(false);
+   }
+
+   for (int t = confirmed + 1; t <= known; t++)
+      Lockstep::confirm(t, hashes[t % ROLLBACK_RING]);
+   confirmed = known;
+}
+
+/******************************************************************
+ * ROLLBACK : PLAY
+ * One tick, remembering what we need to come back to it
+ ****************************************************************/
+void Rollback::play(Game & game, int tick, const int keys[], bool again)
+{
+   int slot = tick % ROLLBACK_RING;
+   game.saveState(states[slot]);
+   guesses[slot] = (unsigned char)keys[1 - Lockstep::getSide()];
+   game.handleInput(keys, LOCKSTEP_PLAYERS);
+   game.advance();
+   hashes[slot] = game.getStateHash();
+   if (again)
+      resimulated++;
+}
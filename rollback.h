@@ -0,0 +1,67 @@
+/***********************************************************************
+ * Header File:
+ *    Rollback : play now, fix it later
+ * Summary:
+ *    Lockstep with an input delay is fair but feels sluggish once the
+ *    delay grows past a few ticks.  With rollback our own keys are
+ *    played right away, and the peer's are guessed: it is assumed to
+ *    hold whatever it held last, which is right far more often than
+ *    not.  The state before every tick we played on a guess is kept in
+ *    a ring.  When the peer's real keys arrive and differ from the
+ *    guess, we load the state from just before that tick and play
+ *    every tick since over again, all within the one frame, so the
+ *    screen catches up at once.
+ *
+ *    We never get more than a set number of ticks ahead of the last
+ *    one we know the peer's keys for.  Past that we wait, the same as
+ *    plain lockstep.  Hashes are only sent for ticks that can no
+ *    longer change, so the desync check still works.
+ ************************************************************************/
+
+#ifndef ROLLBACK_H
+#define ROLLBACK_H
+
+class Game;
+
+#define ROLLBACK_DEFAULT_TICKS  8    // how far ahead we may guess
+#define ROLLBACK_MAX_TICKS      16
+#define ROLLBACK_RING           (ROLLBACK_MAX_TICKS + 1)
+
+/*********************************************
+ * ROLLBACK
+ * Rides on the lockstep session, so there is
+ * one and everything is static
+ *********************************************/
+class Rollback
+{
+public:
+   // roll back at most this many ticks.  Lockstep must be connected
+   static void start(int maxTicks = ROLLBACK_DEFAULT_TICKS);
+   static bool isActive() { return active; }
+
+   // play the next tick with these local keys, first going back to
+   // fix any ticks the peer's keys proved wrong.  Returns false if we
+   // are too far ahead of the peer and must wait
+   static bool step(Game & game, int keys);
+
+   // at the end of a session: wait for the peer's keys for every tick
+   // we played and fix the last guesses.  False if the session broke
+   static bool settle(Game & game);
+
+   static int getRollbacks()   { return rollbacks;   }   // times we went back
+   static int getResimulated() { return resimulated; }   // ticks played again
+   static int getStalls()      { return stalls;      }   // frames we waited
+
+private:
+   static void reconcile(Game & game);
+   static void play(Game & game, int tick, const int keys[], bool again);
+
+   static bool active;
+   static int  maxTicks;
+   static int  confirmed;     // newest tick played with the peer's real keys
+   static int  rollbacks;
+   static int  resimulated;
+   static int  stalls;
+};
+
+#endif // ROLLBACK_H
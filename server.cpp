@@ -0,0 +1,566 @@
+/***********************************************************************
+ * Source File:
+ *    Server : one game, many screens
+ * Summary:
+ *    Packets are packed with a BitWriter, most significant bit first:
+ *
+ *       HELLO     magic(32) type(8) watch(16) range(16)
+ *       WELCOME   magic(32) type(8) player(16) world(16)
+ *       SNAPSHOT  magic(32) type(8) tick(32) baseline(32) player(16)
+ *                 score(32) then the snapshot itself, then
+ *                 events(8) and for each type(3) tier(2) x(20) y(20)
+ *       ACK       magic(32) type(8) tick(32) keys(8)
+ *       BYE       magic(32) type(8)
+ *
+ *    watch is the player to look at, or SERVER_FLY for a new ship.
+ *    range is how far the client can see from that ship.  world is
+ *    half the arena's width.  baseline is the tick the snapshot is the
+ *    difference from, -1 for none.  The events are the rocks and ships
+ *    destroyed within range that tick, positioned like the snapshot.
+ *    A client says HELLO until it is welcomed; a lost WELCOME is sent
+ *    again.
+ *
+ *    What a client sees is kept separately for each one: everything in
+ *    range, plus the big rocks outside it as they were when last sent.
+ *    Each far rock gathers priority every tick it is not sent, more the
+ *    nearer it is, and the few with the most are sent and start over.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstring>    // for memset()
+#include <cmath>      // for sqrt()
+#include <cstdlib>    // for abs()
+#include <vector>
+#include <algorithm>  // for partial_sort()
+
+#ifdef _WIN32
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#pragma comment(lib, "ws2_32.lib")
+typedef SOCKET Socket;
+#define closeSocket closesocket
+#define pollSocket  WSAPoll
+typedef WSAPOLLFD PollFd;
+#else
+#include <unistd.h>       // for close()
+#include <poll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+typedef int Socket;
+#define INVALID_SOCKET -1
+#define closeSocket close
+#define pollSocket  poll
+typedef pollfd PollFd;
+#endif // _WIN32
+
+#include "server.h"
+#include "snapshot.h"
+#include "game.h"
+#include "world.h"
+#include "rocks.h"        // for ROCK_BIG
+#include "eventBus.h"
+#include "spatialGrid.h"
+#include "frameTimer.h"   // for monotonicNow()
+
+using namespace std;
+
+bool      Server::active        = false;
+int       Server::tick          = 0;
+long long Server::bytesSent     = 0;
+long long Server::snapshotsSent = 0;
+long long Server::fullSent      = 0;
+long long Server::captureNs     = 0;
+long long Server::clientNs      = 0;
+long long Server::entitiesSent  = 0;
+long long Server::entitiesSeen  = 0;
+
+/*********************************************
+ * INTEREST
+ * How overdue a far-off big rock is
+ *********************************************/
+struct Interest
+{
+   unsigned int id;
+   float        priority;
+   int          index;      // into this tick's world, while choosing
+};
+
+/*********************************************
+ * CLIENT
+ * Somebody we send snapshots to, and the last
+ * few we sent, any of which may be its baseline
+ *********************************************/
+struct Client
+{
+   sockaddr_in address;
+   int         player;      // whose ship it sees
+   bool        flying;      // and the ship is its own
+   int         ack;         // newest snapshot it has, -1 for none
+   int         keys;        // what it holds, when flying
+   int         range;       // how far it sees, in snapshot steps
+   long long   lastHeard;
+   vector<Interest> distant;             // far big rocks, by id
+   Snapshot    sent[SERVER_HISTORY];   // by tick % SERVER_HISTORY
+};
+
+static Socket            sock = INVALID_SOCKET;
+static vector<Client *>  clients;
+static vector<int>       playerKeys;   // by player
+static vector<int>       freeShips;    // players nobody flies any more
+static Snapshot          world;        // this tick, for everyone
+static SpatialGrid<int>  grid;         // world's entities by where they are
+static vector<int>       shipOf;       // world's index of each player's ship
+static EventSubscriber * pEvents = NULL;
+static vector<GameEvent> events;       // destroyed this tick
+static unsigned char     buffer[SERVER_PACKET_MAX];
+
+/******************************************************************
+ * WAIT FOR PACKET
+ ****************************************************************/
+static bool waitForPacket(int waitMs)
+{
+   PollFd waiting = { sock, POLLIN, 0 };
+   return pollSocket(&waiting, 1, waitMs) > 0;
+}
+
+/******************************************************************
+ * SEND PACKET
+ ****************************************************************/
+static void sendPacket(const Client & client, int size)
+{
+   sendto(sock, (const char *)buffer, size, 0,
+          (const sockaddr *)&client.address, sizeof(client.address));
+}
+
+/******************************************************************
+ * FIND CLIENT
+ * The client at this address, or -1
+ ****************************************************************/
+static int findClient(const sockaddr_in & from)
+{
+   for (size_t i = 0; i < clients.size(); i++)
+      if (clients[i]->address.sin_addr.s_addr == from.sin_addr.s_addr &&
+          clients[i]->address.sin_port == from.sin_port)
+         return (int)i;
+   return -1;
+}
+
+/******************************************************************
+ * DROP CLIENT
+ * Its ship, if it had one, waits for the next client to fly it
+ ****************************************************************/
+static void dropClient(int index)
+{
+   Client * pClient = clients[index];
+   if (pClient->flying)
+   {
+      playerKeys[pClient->player] = 0;
+      freeShips.push_back(pClient->player);
+   }
+   delete pClient;
+   clients.erase(clients.begin() + index);
+}
+
+/******************************************************************
+ * SEND WELCOME
+ ****************************************************************/
+static void sendWelcome(const Client & client)
+{
+   BitWriter out(buffer, sizeof(buffer));
+   out.write(SERVER_MAGIC, 32);
+   out.write(SERVER_WELCOME, 8);
+   out.write(client.player, 16);
+   out.write((unsigned int)World::getXMax(), 16);
+   sendPacket(client, out.finish());
+}
+
+/******************************************************************
+ * SERVER : START
+ ****************************************************************/
+bool Server::start(int port)
+{
+   assert(!active);
+
+#ifdef _WIN32
+   WSADATA wsa;
+   if (WSAStartup(MAKEWORD(2, 2), &wsa) != 0)
+      return false;
+#endif // _WIN32
+
+   sock = socket(AF_INET, SOCK_DGRAM, 0);
+   if (sock == INVALID_SOCKET)
+      return false;
+   sockaddr_in local;
+   memset(&local, 0, sizeof(local));
+   local.sin_family      = AF_INET;
+   local.sin_port        = htons((unsigned short)port);
+   local.sin_addr.s_addr = htonl(INADDR_ANY);
+   if (::bind(sock, (sockaddr *)&local, sizeof(local)) != 0)
+   {
+      closeSocket(sock);
+      return false;
+   }
+
+   delete pEvents;
+   pEvents       = new EventSubscriber;
+   tick          = 0;
+   bytesSent     = 0;
+   snapshotsSent = 0;
+   fullSent      = 0;
+   captureNs     = 0;
+   clientNs      = 0;
+   entitiesSent  = 0;
+   entitiesSeen  = 0;
+   active        = true;
+   return true;
+}
+
+/******************************************************************
+ * SERVER : GET PORT
+ * The one we got, when we asked for any
+ ****************************************************************/
+int Server::getPort()
+{
+   sockaddr_in local;
+   socklen_t size = sizeof(local);
+   if (!active || getsockname(sock, (sockaddr *)&local, &size) != 0)
+      return 0;
+   return ntohs(local.sin_port);
+}
+
+/******************************************************************
+ * SERVER : STOP
+ ****************************************************************/
+void Server::stop()
+{
+   if (!active)
+      return;
+   active = false;
+
+   BitWriter out(buffer, sizeof(buffer));
+   out.write(SERVER_MAGIC, 32);
+   out.write(SERVER_BYE, 8);
+   int size = out.finish();
+   for (size_t i = 0; i < clients.size(); i++)
+   {
+      sendPacket(*clients[i], size);
+      delete clients[i];
+   }
+   clients.clear();
+   playerKeys.clear();
+   freeShips.clear();
+   delete pEvents;
+   pEvents = NULL;
+
+   closeSocket(sock);
+#ifdef _WIN32
+   WSACleanup();
+#endif // _WIN32
+}
+
+/******************************************************************
+ * SERVER : GET CLIENT COUNT
+ ****************************************************************/
+int Server::getClientCount()
+{
+   return (int)clients.size();
+}
+
+/******************************************************************
+ * SERVER : RECEIVE
+ * Everything the clients sent since the last tick
+ ****************************************************************/
+void Server::receive(Game & game)
+{
+   assert(active);
+   long long now = monotonicNow();
+   playerKeys.resize(game.getPlayerCount(), 0);
+
+   while (waitForPacket(0))
+   {
+      sockaddr_in from;
+      socklen_t fromSize = sizeof(from);
+      int size = (int)recvfrom(sock, (char *)buffer, sizeof(buffer), 0,
+                               (sockaddr *)&from, &fromSize);
+      BitReader in(buffer, size > 0 ? size : 0);
+      if (in.read(32) != SERVER_MAGIC)
+         continue;
+      int type  = in.read(8);
+      int index = findClient(from);
+
+      if (type == SERVER_HELLO)
+      {
+         int watch = in.readSigned(16);
+         int range = in.read(16);
+         if (in.isOverrun())
+            continue;
+         if (index < 0)
+         {
+            if ((int)clients.size() >= SERVER_MAX_CLIENTS)
+               continue;
+            Client * pClient = new Client;
+            pClient->address = from;
+            pClient->ack     = -1;
+            pClient->keys    = 0;
+            pClient->range   = quantise((float)range);
+            pClient->flying  = watch == SERVER_FLY;
+            if (!pClient->flying)
+               pClient->player = watch >= 0 && watch < game.getPlayerCount() ?
+                                 watch : 0;
+            else if (!freeShips.empty())
+            {
+               pClient->player = freeShips.back();
+               freeShips.pop_back();
+            }
+            else
+            {
+               pClient->player = game.getPlayerCount();
+               game.addPlayer(World::getSpawnPoint());
+               playerKeys.push_back(0);
+            }
+            clients.push_back(pClient);
+            index = (int)clients.size() - 1;
+         }
+         clients[index]->lastHeard = now;
+         sendWelcome(*clients[index]);
+      }
+      else if (type == SERVER_ACK && index >= 0)
+      {
+         Client & client = *clients[index];
+         int ack  = in.readSigned(32);
+         int keys = in.read(8);
+         if (in.isOverrun())
+            continue;
+         if (ack > client.ack && ack < tick)
+            client.ack = ack;
+         client.keys = keys;
+         if (client.flying)
+            playerKeys[client.player] = keys;
+         client.lastHeard = now;
+      }
+      else if (type == SERVER_BYE && index >= 0)
+         dropClient(index);
+   }
+
+   for (int i = (int)clients.size() - 1; i >= 0; i--)
+      if (now - clients[i]->lastHeard > SERVER_TIMEOUT_MS * 1000000LL)
+         dropClient(i);
+}
+
+/******************************************************************
+ * SERVER : GET KEYS
+ ****************************************************************/
+int Server::getKeys(int player)
+{
+   return player >= 0 && player < (int)playerKeys.size() ? playerKeys[player]
+                                                         : 0;
+}
+
+/******************************************************************
+ * INDEX WORLD
+ * Where everything is this tick, which ship is whose, and what was
+ * destroyed
+ ****************************************************************/
+static void indexWorld(int players)
+{
+   grid.reset(World::getXMin(), World::getYMin(),
+              World::getXMax(), World::getYMax());
+   shipOf.assign(players, -1);
+   for (size_t i = 0; i < world.entities.size(); i++)
+   {
+      const EntityState & e = world.entities[i];
+      grid.add((int)i, Point(unquantise(e.x), unquantise(e.y)));
+      if (e.kind == ENTITY_SHIP && e.owner < players)
+         shipOf[e.owner] = (int)i;
+   }
+   grid.build();
+
+   events.clear();
+   GameEvent event;
+   while (pEvents->poll(event))
+      if (event.type == EVENT_ROCK_DESTROYED || event.type == EVENT_SHIP_KILLED)
+         events.push_back(event);
+}
+
+/******************************************************************
+ * GATHER VIEW
+ * What this client is shown this tick: what is in range, the far
+ * big rocks whose turn it is, and the other far big rocks as the
+ * client last saw them
+ ****************************************************************/
+static void gatherView(Client & client, int cx, int cy, Snapshot & view,
+                       int tick)
+{
+   static vector<char>     inView;     // by world index: 1 near, 2 chosen
+   static vector<int>      nearby;
+   static vector<Interest> distant;
+   static vector<int>      order;
+
+   const vector<EntityState> & all = world.entities;
+   inView.assign(all.size(), 0);
+
+   // everything in range
+   nearby.clear();
+   auto collect = [](int index) { nearby.push_back(index); };
+   float range = unquantise(client.range);
+   grid.query(unquantise(cx) - range, unquantise(cy) - range,
+              unquantise(cx) + range, unquantise(cy) + range, collect);
+   for (size_t i = 0; i < nearby.size(); i++)
+   {
+      const EntityState & e = all[nearby[i]];
+      if (abs(e.x - cx) <= client.range && abs(e.y - cy) <= client.range)
+         inView[nearby[i]] = 1;
+   }
+   if (client.player < (int)shipOf.size() && shipOf[client.player] >= 0)
+      inView[shipOf[client.player]] = 1;
+
+   // the far big rocks build up priority, both lists being by id
+   distant.clear();
+   size_t old = 0;
+   for (size_t i = 0; i < all.size(); i++)
+   {
+      const EntityState & e = all[i];
+      if (inView[i] || e.kind != ENTITY_ROCK || e.detail != ROCK_BIG)
+         continue;
+      while (old < client.distant.size() && client.distant[old].id < e.id)
+         old++;
+      Interest interest;
+      interest.id       = e.id;
+      interest.index    = (int)i;
+      interest.priority = old < client.distant.size() &&
+                          client.distant[old].id == e.id ?
+                          client.distant[old].priority : 0.0f;
+      float dx = (float)(e.x - cx);
+      float dy = (float)(e.y - cy);
+      interest.priority += client.range / (sqrt(dx * dx + dy * dy) + 1.0f);
+      distant.push_back(interest);
+   }
+
+   // the few most overdue go now
+   order.resize(distant.size());
+   for (size_t i = 0; i < order.size(); i++)
+      order[i] = (int)i;
+   size_t chosen = order.size() < SERVER_DISTANT_BUDGET ? order.size()
+                                                        : SERVER_DISTANT_BUDGET;
+   partial_sort(order.begin(), order.begin() + chosen, order.end(),
+                [](int lhs, int rhs)
+                { return distant[lhs].priority > distant[rhs].priority; });
+   for (size_t i = 0; i < chosen; i++)
+   {
+      distant[order[i]].priority = 0.0f;
+      inView[distant[order[i]].index] = 2;
+   }
+   client.distant.swap(distant);
+
+   // the rest of the far ones stay as they were
+   const Snapshot & last = client.sent[(tick + SERVER_HISTORY - 1) % SERVER_HISTORY];
+   const Snapshot * pLast = last.tick == tick - 1 ? &last : NULL;
+   view.tick = tick;
+   view.entities.clear();
+   for (size_t i = 0; i < all.size(); i++)
+   {
+      const EntityState & e = all[i];
+      if (inView[i])
+         view.entities.push_back(e);
+      else if (pLast && e.kind == ENTITY_ROCK && e.detail == ROCK_BIG)
+      {
+         const EntityState * pSeen = pLast->find(e.id);
+         if (pSeen)
+            view.entities.push_back(*pSeen);
+      }
+   }
+}
+
+/******************************************************************
+ * WRITE EVENTS
+ * The ones in range of this client
+ ****************************************************************/
+static void writeEvents(BitWriter & out, int cx, int cy, int range)
+{
+   int margin = quantise(BIG_ROCK_SIZE);
+   int count = 0;
+   for (size_t i = 0; i < events.size(); i++)
+      if (abs(quantise(events[i].x) - cx) <= range + margin &&
+          abs(quantise(events[i].y) - cy) <= range + margin)
+         count++;
+   if (count > SERVER_EVENTS_MAX)
+      count = SERVER_EVENTS_MAX;
+   if (out.getBitsLeft() < 8 + count * 45)
+      count = 0;
+   out.write(count, 8);
+   for (size_t i = 0; i < events.size() && count > 0; i++)
+   {
+      const GameEvent & event = events[i];
+      int x = quantise(event.x);
+      int y = quantise(event.y);
+      if (abs(x - cx) > range + margin || abs(y - cy) > range + margin)
+         continue;
+      out.write(event.type, 3);
+      out.write(event.tier >= 0 ? event.tier : 0, 2);
+      out.writeSigned(x, SNAPSHOT_POSITION_BITS);
+      out.writeSigned(y, SNAPSHOT_POSITION_BITS);
+      count--;
+   }
+}
+
+/******************************************************************
+ * SERVER : SEND
+ * The game is copied out once, then each client gets the
+ * difference between what it should see now and the newest
+ * snapshot it has that we still remember
+ ****************************************************************/
+void Server::send(const Game & game)
+{
+   assert(active);
+   long long begin = monotonicNow();
+   game.captureSnapshot(world, tick);
+   indexWorld(game.getPlayerCount());
+   long long captured = monotonicNow();
+   captureNs += captured - begin;
+
+   for (size_t i = 0; i < clients.size(); i++)
+   {
+      Client & client = *clients[i];
+      int cx = 0;
+      int cy = 0;
+      if (client.player < (int)shipOf.size() && shipOf[client.player] >= 0)
+      {
+         cx = world.entities[shipOf[client.player]].x;
+         cy = world.entities[shipOf[client.player]].y;
+      }
+      Snapshot & snapshot = client.sent[tick % SERVER_HISTORY];
+      gatherView(client, cx, cy, snapshot, tick);
+      entitiesSent += snapshot.entities.size();
+      entitiesSeen += world.entities.size();
+
+      const Snapshot * pBaseline = NULL;
+      if (client.ack >= 0 && tick - client.ack < SERVER_HISTORY &&
+          client.sent[client.ack % SERVER_HISTORY].tick == client.ack)
+         pBaseline = &client.sent[client.ack % SERVER_HISTORY];
+
+      BitWriter out(buffer, sizeof(buffer));
+      out.write(SERVER_MAGIC, 32);
+      out.write(SERVER_SNAPSHOT, 8);
+      out.write(tick, 32);
+      out.writeSigned(pBaseline ? pBaseline->tick : -1, 32);
+      out.write(client.player, 16);
+      out.write(game.getScore(client.player), 32);
+
+      // the client did not get whatever did not fit, so this is no
+      // good as a baseline
+      if (!snapshot.encode(pBaseline, out))
+         snapshot.tick = -1;
+      writeEvents(out, cx, cy, client.range);
+
+      int size = out.finish();
+      sendPacket(client, size);
+      bytesSent += size;
+      snapshotsSent++;
+      if (!pBaseline)
+         fullSent++;
+   }
+
+   clientNs += monotonicNow() - captured;
+   tick++;
+}
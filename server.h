@@ -0,0 +1,93 @@
+/***********************************************************************
+ * Header File:
+ *    Server : one game, many screens
+ * Summary:
+ *    The server runs the only real copy of the game.  Clients send it
+ *    their keys and get back a snapshot every tick of what is flying
+ *    around, which they draw, smoothing between snapshots.  A client
+ *    can fly a ship of its own or just watch one that is already there.
+ *
+ *    Each snapshot is the difference from the last one the client said
+ *    it got, so a lost packet only means the next difference is from
+ *    further back.  If the client has not said anything for a while,
+ *    it gets everything again.
+ *
+ *    A client is only sent what is around the ship it follows, as far
+ *    as its screen reaches.  Big rocks farther off are sent now and
+ *    then, the nearer ones more often, so the client has a rough idea
+ *    of the world; in between it keeps what it was last told.  Debris
+ *    and stars never go at all: the client makes its own from the
+ *    rocks and ships it is told were destroyed.
+ ************************************************************************/
+
+#ifndef SERVER_H
+#define SERVER_H
+
+class Game;
+
+#define SERVER_MAGIC        0x41535456   // "ASTV"
+#define SERVER_HELLO        1            // client: I am here
+#define SERVER_WELCOME      2            // server: you are this player
+#define SERVER_SNAPSHOT     3            // server: this tick
+#define SERVER_ACK          4            // client: got this tick, holding these keys
+#define SERVER_BYE          5            // either: going away
+
+#define SERVER_PACKET_MAX   65000        // one datagram; fine on the loopback
+#define SERVER_HISTORY      32           // ticks a baseline may be behind
+#define SERVER_MAX_CLIENTS  64
+#define SERVER_TIMEOUT_MS   5000         // forget a client this quiet
+#define SERVER_FLY          -1           // a HELLO asking for its own ship
+
+#define SERVER_INTEREST_RANGE  240       // default: half a screen and a rock
+#define SERVER_DISTANT_BUDGET  4         // far-off big rocks refreshed a tick
+#define SERVER_EVENTS_MAX      255       // destroyed in one snapshot
+
+/*********************************************
+ * SERVER
+ * There is one game to serve, so everything
+ * is static.  Only the game thread calls in
+ *********************************************/
+class Server
+{
+public:
+   // listen for clients on a UDP port, 0 for any.  False if we cannot
+   static bool start(int port);
+
+   // tell the clients we are going
+   static void stop();
+
+   static bool isActive() { return active; }
+   static int  getPort();
+
+   // before a tick: greet new clients, giving them ships if they want
+   // them, and take everybody's keys
+   static void receive(Game & game);
+
+   // the keys held by the client flying this player's ship
+   static int getKeys(int player);
+
+   // after a tick: a snapshot to each client
+   static void send(const Game & game);
+
+   static int       getClientCount();
+   static long long getBytesSent()     { return bytesSent;     }
+   static long long getSnapshotsSent() { return snapshotsSent; }
+   static long long getFullSent()      { return fullSent;      }   // without a baseline
+   static long long getCaptureNs()     { return captureNs;     }   // copying out the game
+   static long long getClientNs()      { return clientNs;      }   // encoding and sending
+   static long long getEntitiesSent()  { return entitiesSent;  }   // in the clients' views
+   static long long getEntitiesSeen()  { return entitiesSeen;  }   // in the world, once a client
+
+private:
+   static bool      active;
+   static int       tick;            // the next snapshot's
+   static long long bytesSent;
+   static long long snapshotsSent;
+   static long long fullSent;
+   static long long captureNs;
+   static long long clientNs;
+   static long long entitiesSent;
+   static long long entitiesSeen;
+};
+
+#endif // SERVER_H
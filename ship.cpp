@@ -1,20 +1,32 @@
 #include "ship.h"
+#include "allocTracker.h"
+#include "world.h"
+#include "qualityGovernor.h"
+
+/***************************************
+* SHIP :: DESTRUCTOR
+* The trail belongs to the ship
+***************************************/
+Ship::~Ship()
+{
+   for (std::list<Bullet*>::iterator trailIt = trail.begin(); trailIt != trail.end(); trailIt++)
+      delete *trailIt;
+}
 
 /***************************************
 * GAME :: DRAW
 * Draws the ship and blue particles
 ***************************************/
-void Ship::draw(Interface ui)
+void Ship::draw()
 {
    for (std::list<Bullet*>::iterator trailIt = trail.begin(); trailIt != trail.end(); trailIt++)
    {
-      changeColor(0, random(0.0, 0.5), random(0.0, 1.0));
-      drawDot((*trailIt)->getPosition());
+      batchDot((*trailIt)->getPosition(),
+               0, random(0.0, 0.5), random(0.0, 1.0));
    }
-   changeColor(1, 1, 1);
    if (isAlive())
    {
-      drawShip(getPosition(), getRotation(), ui.isUp());
+      drawShip(getPosition(), getRotation(), thrusting);
    }
 }
 
@@ -23,11 +35,14 @@ void Ship::draw(Interface ui)
 * Handles the ships movement and it handles
 * the particles behind the ship
 ***************************************/
-void Ship::advance()
+void Ship::advance(bool withTrail)
 {
+   ALLOC_SCOPE("Ship::advance");
    speed = sqrt(pow(getVelocity().getDx(), 2) + pow(getVelocity().getDy(), 2));
    setX(getPosition().getX() + getVelocity().getDx());
    setY(getPosition().getY() + getVelocity().getDy());
+   if (!withTrail)
+      return;
    std::list<Bullet*>::iterator trailIt = trail.begin();
    while (trailIt != trail.end())
    {
@@ -42,9 +57,9 @@ void Ship::advance()
       else
          trailIt++;
    }
-   if (isAlive())
+   if (isAlive() && QualityGovernor::isTrailTick(trailTick++))
    {
-      Bullet *pTrail = new Bullet();
+      Bullet *pTrail = new Bullet(DECORATION);
       pTrail->setLives(60);
       pTrail->setPosition(getPosition());
       pTrail->setRotation(getRotation() + (random(0, 1) ? random(120, 180) : random(120, 180) * -1));
@@ -59,6 +74,7 @@ void Ship::advance()
 ***************************************/
 void Ship::thrust()
 {
+   thrusting = true;
    Velocity v = getVelocity();
    float xSpeed = v.getDx() + (cos((getRotation() + 90) * PI / 180) / 2);
    float ySpeed = v.getDy() + (sin((getRotation() + 90) * PI / 180) / 2);
@@ -107,10 +123,7 @@ void Ship::turnLeft()
 ***************************************/
 void Ship::setX(float x)
 {
-   if (x > 200 + getSize())
-      x = -200 - getSize();
-   else if (x < -200 - getSize())
-      x = 200 + getSize();
+   World::wrapX(x, getSize());
    setPosition(Point(x, getPosition().getY()));
 }
 
@@ -121,9 +134,6 @@ void Ship::setX(float x)
 ***************************************/
 void Ship::setY(float y)
 {
-   if (y > 200 + getSize())
-      y = -200 - getSize();
-   else if (y < -200 - getSize())
-      y = 200 + getSize();
+   World::wrapY(y, getSize());
    setPosition(Point(getPosition().getX(), y));
 }
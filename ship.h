@@ -17,17 +17,23 @@
 class Ship : public Bullet
 {
   public:
-   Ship() { setSize(10); }
-   void advance();
-   void draw(Interface ui);
+   Ship() : trailTick(0), thrusting(false) { setSize(10); }
+   ~Ship();
+   void advance(bool withTrail = true);   // the trail is only for show
+   void draw();
    void thrust();
+   bool isThrusting() const { return thrusting; }
+   void setThrusting(bool thrusting) { this->thrusting = thrusting; }
    void turnRight();
    void turnLeft();
    void setX(float x);
    void setY(float y);
+   int getTrailCount() const { return (int)trail.size(); }
   private:
    float speed;
    std::list<Bullet*> trail;
+   int trailTick;              // advances so far, for thinning the trail
+   bool thrusting;             // thrust() was called this tick
 };
 
 #endif /* ship_h */
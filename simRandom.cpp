@@ -0,0 +1,42 @@
+/***********************************************************************
+ * Source File:
+ *    Sim Random : the random numbers that decide how a game plays out
+ * Summary:
+ *    SplitMix64, as published by Steele, Lea and Flood.  Each call
+ *    steps a 64-bit counter and scrambles it.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include "simRandom.h"
+
+#define SIM_RANDOM_DEFAULT_SEED 1
+
+unsigned long long SimRandom::state = SIM_RANDOM_DEFAULT_SEED;
+
+/******************************************************************
+ * SIM RANDOM : SEED
+ ****************************************************************/
+void SimRandom::seed(unsigned long long seed)
+{
+   state = seed;
+}
+
+/******************************************************************
+ * SIM RANDOM : NEXT
+ *    INPUT:   min, max : The range of values (min <= num <= max)
+ *    OUTPUT   <return> : The number
+ ****************************************************************/
+int SimRandom::next(int min, int max)
+{
+   assert(min <= max);
+   state += 0x9e3779b97f4a7c15ULL;
+   unsigned long long z = state;
+   z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+   z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+   z ^= z >> 31;
+
+   unsigned long long range = (unsigned long long)((long long)max - min) + 1;
+   int num = (int)((long long)min + (long long)(z % range));
+   assert(min <= num && num <= max);
+   return num;
+}
@@ -0,0 +1,41 @@
+/***********************************************************************
+ * Header File:
+ *    Sim Random : the random numbers that decide how a game plays out
+ * Summary:
+ *    Where the rocks start, which way they spin and how they bounce
+ *    off each other all come from here.  The twinkling stars, the
+ *    debris and the ship's trail keep using rand(), and so does the
+ *    drawing code, so how often we draw and how much eye candy the
+ *    quality governor allows can never change the game.
+ *
+ *    The generator is SplitMix64: small, fast, and the same sequence
+ *    on every compiler and platform, which rand() is not.  Two games
+ *    seeded alike and given the same keys play out the same, down to
+ *    the last bit.
+ ************************************************************************/
+
+#ifndef SIM_RANDOM_H
+#define SIM_RANDOM_H
+
+/*********************************************
+ * SIM RANDOM
+ * There is one simulation, so one generator
+ *********************************************/
+class SimRandom
+{
+public:
+   // start the sequence over
+   static void seed(unsigned long long seed);
+
+   // a number from min to max, both included
+   static int next(int min, int max);
+
+   // where the sequence is, to save it and to pick it up again later
+   static unsigned long long getState() { return state; }
+   static void setState(unsigned long long state) { SimRandom::state = state; }
+
+private:
+   static unsigned long long state;
+};
+
+#endif // SIM_RANDOM_H
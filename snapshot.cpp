@@ -0,0 +1,418 @@
+/***********************************************************************
+ * Source File:
+ *    Snapshot : what a client is shown of the game, packed small
+ * Summary:
+ *    The body of a snapshot is the count of ids that are gone and the
+ *    ids, then the count of entities that changed and the entities, all
+ *    in order of id.  Each id goes as the gap from the one before.  An
+ *    entity is then:
+ *
+ *       new(1)  1: kind(2) detail(4) owner(8) rotation(8) x(20) y(20)
+ *               0: moved(1)   then for x and y, big(1) and the change
+ *                             in 8 bits or the place in 20
+ *                  turned(1)  then rotation(8)
+ *                  other(1)   then detail(4) owner(8)
+ *
+ *    An entity is new when the baseline does not have it.  Anything in
+ *    the baseline that is neither gone nor changed is just as it was.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstddef>    // for NULL
+#include "snapshot.h"
+
+using namespace std;
+
+/******************************************************************
+ * MASK
+ * The low bits ones
+ ****************************************************************/
+static inline unsigned long long mask(int bits)
+{
+   return (1ULL << bits) - 1;
+}
+
+/******************************************************************
+ * BIT WRITER : WRITE
+ ****************************************************************/
+void BitWriter::write(unsigned int value, int bits)
+{
+   assert(bits > 0 && bits <= 32);
+   if (full || bits > getBitsLeft())
+   {
+      full = true;
+      return;
+   }
+   scratch = (scratch << bits) | (value & mask(bits));
+   scratchBits += bits;
+   while (scratchBits >= 8)
+   {
+      scratchBits -= 8;
+      buffer[pos++] = (unsigned char)(scratch >> scratchBits);
+   }
+}
+
+/******************************************************************
+ * BIT WRITER : WRITE VAR
+ ****************************************************************/
+void BitWriter::writeVar(unsigned int value)
+{
+   while (value >= 16)
+   {
+      write(0x10 | (value & 0x0f), 5);
+      value >>= 4;
+   }
+   write(value, 5);
+}
+
+/******************************************************************
+ * BIT WRITER : FINISH
+ ****************************************************************/
+int BitWriter::finish()
+{
+   if (scratchBits > 0)
+   {
+      buffer[pos++] = (unsigned char)(scratch << (8 - scratchBits));
+      scratchBits = 0;
+   }
+   return pos;
+}
+
+/******************************************************************
+ * BIT READER : READ
+ ****************************************************************/
+unsigned int BitReader::read(int bits)
+{
+   assert(bits > 0 && bits <= 32);
+   while (scratchBits < bits)
+   {
+      if (pos >= size)
+      {
+         overrun = true;
+         return 0;
+      }
+      scratch = (scratch << 8) | buffer[pos++];
+      scratchBits += 8;
+   }
+   scratchBits -= bits;
+   return (unsigned int)((scratch >> scratchBits) & mask(bits));
+}
+
+/******************************************************************
+ * BIT READER : READ SIGNED
+ ****************************************************************/
+int BitReader::readSigned(int bits)
+{
+   long long value = read(bits);
+   if (value & (1LL << (bits - 1)))
+      value -= 1LL << bits;
+   return (int)value;
+}
+
+/******************************************************************
+ * BIT READER : READ VAR
+ ****************************************************************/
+unsigned int BitReader::readVar()
+{
+   unsigned int value = 0;
+   for (int shift = 0; shift < 32 && !overrun; shift += 4)
+   {
+      unsigned int group = read(5);
+      value |= (group & 0x0f) << shift;
+      if (!(group & 0x10))
+         break;
+   }
+   return value;
+}
+
+/******************************************************************
+ * SNAPSHOT : FIND
+ ****************************************************************/
+const EntityState * Snapshot::find(unsigned int id) const
+{
+   size_t low = 0;
+   size_t high = entities.size();
+   while (low < high)
+   {
+      size_t middle = (low + high) / 2;
+      if (entities[middle].id < id)
+         low = middle + 1;
+      else
+         high = middle;
+   }
+   return low < entities.size() && entities[low].id == id ? &entities[low]
+                                                          : NULL;
+}
+
+/******************************************************************
+ * FITS DELTA
+ * Is the change small enough for the short form?
+ ****************************************************************/
+static inline bool fitsDelta(int delta)
+{
+   return delta >= -(1 << (SNAPSHOT_DELTA_BITS - 1)) &&
+          delta <   (1 << (SNAPSHOT_DELTA_BITS - 1));
+}
+
+/******************************************************************
+ * WRITE AXIS / READ AXIS
+ * One coordinate, as a change from the baseline if it is small
+ ****************************************************************/
+static void writeAxis(BitWriter & out, int value, int base)
+{
+   if (fitsDelta(value - base))
+   {
+      out.write(0, 1);
+      out.writeSigned(value - base, SNAPSHOT_DELTA_BITS);
+   }
+   else
+   {
+      out.write(1, 1);
+      out.writeSigned(value, SNAPSHOT_POSITION_BITS);
+   }
+}
+
+static int readAxis(BitReader & in, int base)
+{
+   if (in.read(1) == 0)
+      return base + in.readSigned(SNAPSHOT_DELTA_BITS);
+   return in.readSigned(SNAPSHOT_POSITION_BITS);
+}
+
+/******************************************************************
+ * SAME
+ * Would the client see any difference?
+ ****************************************************************/
+static inline bool same(const EntityState & lhs, const EntityState & rhs)
+{
+   return lhs.kind == rhs.kind && lhs.detail == rhs.detail &&
+          lhs.owner == rhs.owner && lhs.rotation == rhs.rotation &&
+          lhs.x == rhs.x && lhs.y == rhs.y;
+}
+
+/******************************************************************
+ * WRITE ENTITY
+ * One change: in full if the client does not have it, otherwise
+ * just the parts that are different
+ ****************************************************************/
+static void writeEntity(BitWriter & out, const EntityState & e,
+                        const EntityState * pBase)
+{
+   if (!pBase || pBase->kind != e.kind)
+   {
+      out.write(1, 1);
+      out.write(e.kind,     SNAPSHOT_KIND_BITS);
+      out.write(e.detail,   SNAPSHOT_DETAIL_BITS);
+      out.write(e.owner,    SNAPSHOT_OWNER_BITS);
+      out.write(e.rotation, SNAPSHOT_ROTATION_BITS);
+      out.writeSigned(e.x,  SNAPSHOT_POSITION_BITS);
+      out.writeSigned(e.y,  SNAPSHOT_POSITION_BITS);
+      return;
+   }
+
+   out.write(0, 1);
+   bool moved = e.x != pBase->x || e.y != pBase->y;
+   out.write(moved, 1);
+   if (moved)
+   {
+      writeAxis(out, e.x, pBase->x);
+      writeAxis(out, e.y, pBase->y);
+   }
+   bool turned = e.rotation != pBase->rotation;
+   out.write(turned, 1);
+   if (turned)
+      out.write(e.rotation, SNAPSHOT_ROTATION_BITS);
+   bool other = e.detail != pBase->detail || e.owner != pBase->owner;
+   out.write(other, 1);
+   if (other)
+   {
+      out.write(e.detail, SNAPSHOT_DETAIL_BITS);
+      out.write(e.owner,  SNAPSHOT_OWNER_BITS);
+   }
+}
+
+/******************************************************************
+ * READ ENTITY
+ ****************************************************************/
+static bool readEntity(BitReader & in, EntityState & e,
+                       const Snapshot * pBaseline)
+{
+   if (in.read(1))
+   {
+      e.kind     = in.read(SNAPSHOT_KIND_BITS);
+      e.detail   = in.read(SNAPSHOT_DETAIL_BITS);
+      e.owner    = in.read(SNAPSHOT_OWNER_BITS);
+      e.rotation = in.read(SNAPSHOT_ROTATION_BITS);
+      e.x        = in.readSigned(SNAPSHOT_POSITION_BITS);
+      e.y        = in.readSigned(SNAPSHOT_POSITION_BITS);
+      return true;
+   }
+
+   // not new, so the baseline has it
+   const EntityState * pBase = pBaseline ? pBaseline->find(e.id) : NULL;
+   if (!pBase)
+      return false;
+   unsigned int id = e.id;
+   e = *pBase;
+   e.id = id;
+   if (in.read(1))
+   {
+      e.x = readAxis(in, e.x);
+      e.y = readAxis(in, e.y);
+   }
+   if (in.read(1))
+      e.rotation = in.read(SNAPSHOT_ROTATION_BITS);
+   if (in.read(1))
+   {
+      e.detail = in.read(SNAPSHOT_DETAIL_BITS);
+      e.owner  = in.read(SNAPSHOT_OWNER_BITS);
+   }
+   return true;
+}
+
+/******************************************************************
+ * VAR BITS
+ * What BitWriter::writeVar() will take for this value
+ ****************************************************************/
+static inline int varBits(unsigned int value)
+{
+   int bits = 5;
+   for ( ; value >= 16; value >>= 4)
+      bits += 5;
+   return bits;
+}
+
+/******************************************************************
+ * SNAPSHOT : ENCODE
+ * The baseline is walked alongside, since both are in id order:
+ * first the ids that are gone, then the changes.  Each list takes
+ * only what there is room for; a snapshot that lost any of either
+ * is not one the client can build on
+ ****************************************************************/
+bool Snapshot::encode(const Snapshot * pBaseline, BitWriter & out) const
+{
+   static const vector<EntityState> none;
+   static vector<unsigned int> gone;
+   const vector<EntityState> & base = pBaseline ? pBaseline->entities : none;
+
+   // gone: in the baseline but not here
+   gone.clear();
+   size_t i = 0;
+   for (size_t b = 0; b < base.size(); b++)
+   {
+      while (i < entities.size() && entities[i].id < base[b].id)
+         i++;
+      if (i >= entities.size() || entities[i].id != base[b].id)
+         gone.push_back(base[b].id);
+   }
+
+   // as many as fit, leaving room for both counts
+   int room = out.getBitsLeft() - 2 * SNAPSHOT_COUNT_BITS;
+   size_t fit = 0;
+   unsigned int lastId = 0;
+   for ( ; fit < gone.size() && fit < (1 << SNAPSHOT_COUNT_BITS) - 1; fit++)
+   {
+      int bits = varBits(gone[fit] - lastId);
+      if (bits > room)
+         break;
+      room -= bits;
+      lastId = gone[fit];
+   }
+   out.write((unsigned int)fit, SNAPSHOT_COUNT_BITS);
+   lastId = 0;
+   for (size_t g = 0; g < fit; g++)
+   {
+      out.writeVar(gone[g] - lastId);
+      lastId = gone[g];
+   }
+
+   // changed: here and different, or not in the baseline at all
+   int changed = 0;
+   size_t b = 0;
+   for (i = 0; i < entities.size(); i++)
+   {
+      while (b < base.size() && base[b].id < entities[i].id)
+         b++;
+      if (b >= base.size() || base[b].id != entities[i].id ||
+          !same(base[b], entities[i]))
+         changed++;
+   }
+   room = (out.getBitsLeft() - SNAPSHOT_COUNT_BITS) /
+          (SNAPSHOT_ENTITY_BYTES * 8);
+   int count = changed;
+   if (count > room)
+      count = room > 0 ? room : 0;
+   if (count >= (1 << SNAPSHOT_COUNT_BITS))
+      count = (1 << SNAPSHOT_COUNT_BITS) - 1;
+   out.write(count, SNAPSHOT_COUNT_BITS);
+
+   lastId = 0;
+   b = 0;
+   int written = 0;
+   for (i = 0; i < entities.size() && written < count; i++)
+   {
+      const EntityState & e = entities[i];
+      while (b < base.size() && base[b].id < e.id)
+         b++;
+      const EntityState * pBase = b < base.size() && base[b].id == e.id ?
+                                  &base[b] : NULL;
+      if (pBase && same(*pBase, e))
+         continue;
+      out.writeVar(e.id - lastId);
+      lastId = e.id;
+      writeEntity(out, e, pBase);
+      written++;
+   }
+   assert(!out.isFull());
+   return fit == gone.size() && count == changed;
+}
+
+/******************************************************************
+ * SNAPSHOT : DECODE
+ * The baseline, less what is gone, with the changes laid over it
+ ****************************************************************/
+bool Snapshot::decode(const Snapshot * pBaseline, BitReader & in)
+{
+   static vector<unsigned int> gone;
+   static vector<EntityState>  changes;
+
+   gone.resize(in.read(SNAPSHOT_COUNT_BITS));
+   unsigned int lastId = 0;
+   for (size_t i = 0; i < gone.size() && !in.isOverrun(); i++)
+      gone[i] = lastId = lastId + in.readVar();
+
+   changes.resize(in.read(SNAPSHOT_COUNT_BITS));
+   lastId = 0;
+   for (size_t i = 0; i < changes.size() && !in.isOverrun(); i++)
+   {
+      changes[i].id = lastId = lastId + in.readVar();
+      if (!readEntity(in, changes[i], pBaseline))
+         return false;
+   }
+   if (in.isOverrun())
+      return false;
+
+   static const vector<EntityState> none;
+   const vector<EntityState> & base = pBaseline ? pBaseline->entities : none;
+   entities.clear();
+   size_t g = 0;
+   size_t c = 0;
+   for (size_t b = 0; b < base.size() || c < changes.size(); )
+   {
+      if (b < base.size() && (c >= changes.size() || base[b].id < changes[c].id))
+      {
+         while (g < gone.size() && gone[g] < base[b].id)
+            g++;
+         if (g >= gone.size() || gone[g] != base[b].id)
+            entities.push_back(base[b]);
+         b++;
+      }
+      else
+      {
+         if (b < base.size() && base[b].id == changes[c].id)
+            b++;
+         entities.push_back(changes[c++]);
+      }
+   }
+   return true;
+}
@@ -0,0 +1,154 @@
+/***********************************************************************
+ * Header File:
+ *    Snapshot : what a client is shown of the game, packed small
+ * Summary:
+ *    A server sends every client a snapshot each tick: for each ship,
+ *    rock and bullet, its id, what it is, where it is and which way it
+ *    points.  Positions are kept to an eighth of a unit and rotations to
+ *    256 steps around the circle, neither of which shows on the screen.
+ *
+ *    A snapshot goes out as the difference from a baseline, the newest
+ *    one the client said it got: what is gone, and what changed.
+ *    Anything that did not change costs nothing, anything that moved a
+ *    little a few bits, and only what is new goes in full.  Everything
+ *    is packed bit by bit.  With no baseline, everything is new.
+ ************************************************************************/
+
+#ifndef SNAPSHOT_H
+#define SNAPSHOT_H
+
+#include <vector>
+
+// what an entity is
+#define ENTITY_SHIP    0
+#define ENTITY_ROCK    1   // detail is the tier
+#define ENTITY_BULLET  2   // detail is the weapon
+
+// a ship's detail
+#define ENTITY_ALIVE      0x01
+#define ENTITY_THRUSTING  0x02
+
+#define SNAPSHOT_SCALE          8    // position steps per world unit
+#define SNAPSHOT_POSITION_BITS  20   // signed: 65536 units either way
+#define SNAPSHOT_DELTA_BITS     8    // a small move, signed
+#define SNAPSHOT_ROTATION_BITS  8
+#define SNAPSHOT_KIND_BITS      2
+#define SNAPSHOT_DETAIL_BITS    4
+#define SNAPSHOT_OWNER_BITS     8
+#define SNAPSHOT_COUNT_BITS     16
+#define SNAPSHOT_ENTITY_BYTES   16   // the most one entity can take
+
+/*********************************************
+ * ENTITY STATE
+ * One thing on the screen, quantised
+ *********************************************/
+struct EntityState
+{
+   unsigned int  id;         // FlyingObject::getId()
+   unsigned char kind;       // ENTITY_*
+   unsigned char detail;     // depends on the kind
+   unsigned char rotation;   // 256 steps to a turn
+   unsigned char owner;      // the player, for ships and bullets
+   int           x;          // in steps of 1 / SNAPSHOT_SCALE
+   int           y;
+};
+
+// from the game's units to the snapshot's and back
+inline int   quantise(float value)        { return (int)(value * SNAPSHOT_SCALE + (value < 0 ? -0.5f : 0.5f)); }
+inline float unquantise(int value)        { return (float)value / SNAPSHOT_SCALE; }
+inline unsigned char quantiseRotation(int degrees)
+{
+   degrees %= 360;
+   if (degrees < 0)
+      degrees += 360;
+   return (unsigned char)(degrees * 256 / 360);
+}
+inline int unquantiseRotation(unsigned char rotation) { return rotation * 360 / 256; }
+
+/*********************************************
+ * BIT WRITER
+ * Packs numbers of any width up to 32 bits,
+ * most significant first, into a buffer.
+ * Past the end it stops and says it is full
+ *********************************************/
+class BitWriter
+{
+public:
+   BitWriter(unsigned char * buffer, int capacity)
+      : buffer(buffer), capacity(capacity), pos(0), scratch(0),
+        scratchBits(0), full(false) {}
+
+   void write(unsigned int value, int bits);
+   void writeSigned(int value, int bits) { write((unsigned int)value, bits); }
+
+   // small numbers in few bits: four at a time, with a bit for more
+   void writeVar(unsigned int value);
+
+   // pad out the last byte.  Returns how many bytes were written
+   int finish();
+
+   bool isFull() const { return full; }
+   int getBitsLeft() const { return (capacity - pos) * 8 - scratchBits; }
+
+private:
+   unsigned char *    buffer;
+   int                capacity;
+   int                pos;           // next whole byte
+   unsigned long long scratch;       // bits not yet in the buffer
+   int                scratchBits;
+   bool               full;
+};
+
+/*********************************************
+ * BIT READER
+ * The other end of a BitWriter.  Reading past
+ * the end gives zeros and marks it overrun
+ *********************************************/
+class BitReader
+{
+public:
+   BitReader(const unsigned char * buffer, int size)
+      : buffer(buffer), size(size), pos(0), scratch(0), scratchBits(0),
+        overrun(false) {}
+
+   unsigned int read(int bits);
+   int readSigned(int bits);
+   unsigned int readVar();
+
+   bool isOverrun() const { return overrun; }
+
+private:
+   const unsigned char * buffer;
+   int                   size;
+   int                   pos;
+   unsigned long long    scratch;
+   int                   scratchBits;
+   bool                  overrun;
+};
+
+/*********************************************
+ * SNAPSHOT
+ * Everything a client sees on one tick, in
+ * order of id
+ *********************************************/
+struct Snapshot
+{
+   Snapshot() : tick(-1) {}
+
+   int                      tick;       // -1 for none
+   std::vector<EntityState> entities;   // by id
+
+   // the entity with this id, or NULL
+   const EntityState * find(unsigned int id) const;
+
+   // write what changed since the baseline, NULL for everything.  If
+   // the buffer is too small the changes that do not fit are left off,
+   // and the client is left with what it had.  Returns false if that
+   // happened
+   bool encode(const Snapshot * pBaseline, BitWriter & out) const;
+
+   // the other way.  False if the packet was cut short
+   bool decode(const Snapshot * pBaseline, BitReader & in);
+};
+
+#endif // SNAPSHOT_H
@@ -0,0 +1,228 @@
+/***********************************************************************
+ * Header File:
+ *    Spatial Grid : find things by where they are
+ * Summary:
+ *    A coarse uniform grid over the world.  Every frame the items are
+ *    dropped into the cell under their position, then sorted by cell so
+ *    each cell's items sit next to each other in one array.  Asking for
+ *    everything in a rectangle only looks at the cells it covers.  The
+ *    arrays are reused from frame to frame so rebuilding does not
+ *    allocate once they have grown to size.
+ ************************************************************************/
+
+#ifndef SPATIAL_GRID_H
+#define SPATIAL_GRID_H
+
+#include <vector>
+#include <cassert>
+#include "point.h"
+
+#define GRID_CELL_SIZE  64.0      // world units on a side of a cell
+#define GRID_MAX_CELLS  262144    // grow the cells rather than exceed this
+
+/*********************************************
+ * SPATIAL GRID
+ * T is whatever we want back from a query,
+ * usually a pointer or an index
+ *********************************************/
+template <class T>
+class SpatialGrid
+{
+public:
+   SpatialGrid() : xMin(0.0), yMin(0.0), cellSize(GRID_CELL_SIZE),
+                   cols(1), rows(1) {}
+
+   // cover this rectangle with cells, and forget all the items
+   void reset(float xMin, float yMin, float xMax, float yMax,
+              float cellSize = GRID_CELL_SIZE);
+
+   // add an item at a position.  It is not findable until build()
+   void add(const T & item, const Point & pos)
+   {
+      Entry entry;
+      entry.cell = cellOf(pos.getX(), pos.getY());
+      entry.item = item;
+      pending.push_back(entry);
+   }
+
+   // sort the added items into their cells
+   void build();
+
+   // how many items are in the grid
+   int size() const { return (int)items.size(); }
+
+   // call visit(item) for every item in a cell touching the rectangle
+   template <class Visitor>
+   void query(float left, float bottom, float right, float top,
+              Visitor & visit) const
+   {
+      if (items.empty())
+         return;
+      int c0 = colOf(left);
+      int c1 = colOf(right);
+      int r0 = rowOf(bottom);
+      int r1 = rowOf(top);
+      for (int r = r0; r <= r1; r++)
+         for (int c = c0; c <= c1; c++)
+         {
+            int cell = r * cols + c;
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++)
+               visit(items[i]);
+         }
+   }
+
+   // the item nearest a spot, looking no farther than maxDistance.
+   // distance(item) says how far an item is; it must never be less
+   // than how far the position the item was added at is from the spot.
+   // Returns false if nothing is that close
+   template <class Distance>
+   bool nearest(const Point & pos, float maxDistance, Distance & distance,
+                T & found) const;
+
+   // the items in one cell, for walking the grid cell by cell
+   int getCellCount() const { return cols * rows; }
+   int getCellBegin(int cell) const { return cellStart[cell];     }
+   int getCellEnd(int cell)   const { return cellStart[cell + 1]; }
+   const T & getItem(int i)   const { return items[i];            }
+
+   // which cell a spot falls in, and the cells around it
+   int  cellOf(float x, float y) const { return rowOf(y) * cols + colOf(x); }
+   int  getCols() const { return cols; }
+   int  getRows() const { return rows; }
+   float getCellSize() const { return cellSize; }
+
+private:
+   struct Entry
+   {
+      int cell;
+      T   item;
+   };
+
+   int colOf(float x) const
+   {
+      int c = (int)((x - xMin) / cellSize);
+      return c < 0 ? 0 : (c >= cols ? cols - 1 : c);
+   }
+   int rowOf(float y) const
+   {
+      int r = (int)((y - yMin) / cellSize);
+      return r < 0 ? 0 : (r >= rows ? rows - 1 : r);
+   }
+
+   float xMin;                   // left edge of the first column
+   float yMin;                   // bottom edge of the first row
+   float cellSize;               // width and height of a cell
+   int   cols;                   // cells across
+   int   rows;                   // cells up and down
+   std::vector<Entry> pending;   // added but not yet sorted
+   std::vector<T>     items;     // sorted by cell
+   std::vector<int>   cellStart; // where each cell starts in items
+};
+
+/******************************************************************
+ * SPATIAL GRID : RESET
+ * Lay the cells over the rectangle.  Very large areas get larger
+ * cells so the grid never has more than GRID_MAX_CELLS.
+ ****************************************************************/
+template <class T>
+void SpatialGrid<T>::reset(float xMin, float yMin, float xMax, float yMax,
+                           float cellSize)
+{
+   assert(xMin < xMax && yMin < yMax && cellSize > 0.0);
+   while (((xMax - xMin) / cellSize + 1) * ((yMax - yMin) / cellSize + 1) >
+          GRID_MAX_CELLS)
+      cellSize *= 2.0;
+
+   this->xMin     = xMin;
+   this->yMin     = yMin;
+   this->cellSize = cellSize;
+   cols = (int)((xMax - xMin) / cellSize) + 1;
+   rows = (int)((yMax - yMin) / cellSize) + 1;
+
+   pending.clear();
+   items.clear();
+   cellStart.assign(cols * rows + 1, 0);
+}
+
+/******************************************************************
+ * SPATIAL GRID : BUILD
+ * A counting sort: count the items in each cell, turn the counts
+ * into starting offsets, then drop each item into place.
+ ****************************************************************/
+template <class T>
+void SpatialGrid<T>::build()
+{
+   int cells = cols * rows;
+   cellStart.assign(cells + 1, 0);
+   for (size_t i = 0; i < pending.size(); i++)
+      cellStart[pending[i].cell + 1]++;
+   for (int cell = 0; cell < cells; cell++)
+      cellStart[cell + 1] += cellStart[cell];
+
+   items.resize(pending.size());
+   for (size_t i = 0; i < pending.size(); i++)
+      items[cellStart[pending[i].cell]++] = pending[i].item;
+
+   // the fill moved every start to the next cell's start: shift back
+   for (int cell = cells; cell > 0; cell--)
+      cellStart[cell] = cellStart[cell - 1];
+   cellStart[0] = 0;
+
+   pending.clear();
+}
+
+/******************************************************************
+ * SPATIAL GRID : NEAREST
+ * Look at the cell the spot is in, then the ring of cells around
+ * it, then the ring around that, until the closest thing found is
+ * nearer than anything the next ring could hold.
+ ****************************************************************/
+template <class T>
+template <class Distance>
+bool SpatialGrid<T>::nearest(const Point & pos, float maxDistance,
+                             Distance & distance, T & found) const
+{
+   if (items.empty())
+      return false;
+
+   int col = colOf(pos.getX());
+   int row = rowOf(pos.getY());
+   int rings = cols > rows ? cols : rows;
+   float best = maxDistance;
+   bool fFound = false;
+
+   for (int ring = 0; ring < rings; ring++)
+   {
+      // anything on this ring is at least ring - 1 whole cells away
+      if (ring > 0 && (ring - 1) * cellSize > best)
+         break;
+
+      for (int r = row - ring; r <= row + ring; r++)
+      {
+         if (r < 0 || r >= rows)
+            continue;
+         // the top and bottom rows of the ring are whole, the rest is
+         // just the two ends
+         int step = (r == row - ring || r == row + ring) ? 1 : 2 * ring;
+         for (int c = col - ring; c <= col + ring; c += step)
+         {
+            if (c < 0 || c >= cols)
+               continue;
+            int cell = r * cols + c;
+            for (int i = cellStart[cell]; i < cellStart[cell + 1]; i++)
+            {
+               float d = distance(items[i]);
+               if (d <= best)
+               {
+                  best   = d;
+                  found  = items[i];
+                  fFound = true;
+               }
+            }
+         }
+      }
+   }
+   return fFound;
+}
+
+#endif // SPATIAL_GRID_H
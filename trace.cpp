@@ -0,0 +1,152 @@
+/***********************************************************************
+ * Source File:
+ *    Trace : a timeline of where each frame's time went
+ * Summary:
+ *    The drawing thread fills a single-producer single-consumer ring,
+ *    the same arrangement as the input queue and frame capture.  Each
+ *    span becomes one complete ("X") event; Chrome works out the
+ *    nesting from the times.  Times are written in microseconds from
+ *    the moment tracing started.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include <cstdio>     // for snprintf()
+#include <fstream>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include "trace.h"
+
+using namespace std;
+
+#define TRACE_NAP_MS  10   // how long the writer sleeps when idle
+
+/*********************************************
+ * SPAN RECORD
+ * What the drawing thread hands the writer
+ *********************************************/
+struct SpanRecord
+{
+   const char * name;
+   long long    begin;
+   long long    end;
+};
+
+static SpanRecord        ring[TRACE_RING_SIZE];
+static atomic<long long> head(0);      // next slot the drawing thread fills
+static atomic<long long> tail(0);      // next slot the writer empties
+static atomic<long long> dropped(0);
+static atomic<bool>      running(false);
+static long long         origin = 0;   // time zero in the file
+static ofstream          out;
+static thread            writer;
+
+bool Trace::active = false;
+
+/******************************************************************
+ * WRITE SPAN
+ * One complete event.  Every event after the first starts with a
+ * comma so the array closes cleanly whenever we stop.
+ ****************************************************************/
+static void writeSpan(const SpanRecord & span)
+{
+   char line[256];
+   snprintf(line, sizeof(line),
+            ",\n{\"name\":\"%s\",\"ph\":\"X\",\"pid\":1,\"tid\":1,"
+            "\"ts\":%.3f,\"dur\":%.3f}",
+            span.name,
+            (span.begin - origin) / 1000.0,
+            (span.end - span.begin) / 1000.0);
+   out << line;
+}
+
+/******************************************************************
+ * WRITER
+ * Write whatever is waiting, nap when there is nothing, and quit
+ * once stopped and caught up
+ ****************************************************************/
+static void writerMain()
+{
+   for (;;)
+   {
+      long long t = tail.load(memory_order_relaxed);
+      if (t == head.load(memory_order_acquire))
+      {
+         if (!running.load())
+            break;
+         this_thread::sleep_for(chrono::milliseconds(TRACE_NAP_MS));
+         continue;
+      }
+
+      writeSpan(ring[t & (TRACE_RING_SIZE - 1)]);
+      tail.store(t + 1, memory_order_release);
+   }
+}
+
+/******************************************************************
+ * TRACE : START
+ *   INPUT  path      where the JSON goes
+ *   OUTPUT <return>  false if the file could not be opened
+ ****************************************************************/
+bool Trace::start(const char * path)
+{
+   assert(!active);
+   out.open(path);
+   if (!out.is_open())
+      return false;
+
+   // name the thread so the timeline does not just say "1"
+   out << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n"
+          "{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":1,\"tid\":1,"
+          "\"args\":{\"name\":\"game\"}}";
+
+   origin = monotonicNow();
+   running = true;
+   writer = thread(writerMain);
+   active = true;
+   return true;
+}
+
+/******************************************************************
+ * TRACE : STOP
+ ****************************************************************/
+void Trace::stop()
+{
+   if (!active)
+      return;
+   active = false;
+
+   running = false;
+   writer.join();
+   out << "\n]}\n";
+   out.close();
+}
+
+/******************************************************************
+ * TRACE : RECORD
+ * Drop the span rather than wait if the writer is a whole ring
+ * behind
+ ****************************************************************/
+void Trace::record(const char * name, long long begin, long long end)
+{
+   long long h = head.load(memory_order_relaxed);
+   if (h - tail.load(memory_order_acquire) >= TRACE_RING_SIZE)
+   {
+      dropped.fetch_add(1, memory_order_relaxed);
+      return;
+   }
+
+   SpanRecord & span = ring[h & (TRACE_RING_SIZE - 1)];
+   span.name  = name;
+   span.begin = begin;
+   span.end   = end;
+   head.store(h + 1, memory_order_release);
+}
+
+/******************************************************************
+ * TRACE : GET DROPPED
+ ****************************************************************/
+long long Trace::getDropped()
+{
+   return dropped.load();
+}
@@ -0,0 +1,83 @@
+/***********************************************************************
+ * Header File:
+ *    Trace : a timeline of where each frame's time went
+ * Summary:
+ *    Averages hide stutters.  With tracing on, every TRACE_SCOPE() in
+ *    the frame records when it started and how long it ran, and a
+ *    background thread streams those spans into a Chrome trace-event
+ *    JSON file.  Open it in chrome://tracing or ui.perfetto.dev and one
+ *    bad frame stands out by itself.
+ *
+ *    Spans wait in a fixed ring, so a long session costs no more memory
+ *    than a short one.  If the writer falls behind, spans are dropped
+ *    and counted rather than waited for.
+ ************************************************************************/
+
+#ifndef TRACE_H
+#define TRACE_H
+
+#include "frameTimer.h"   // for monotonicNow()
+
+#define TRACE_RING_SIZE  16384   // spans waiting for the writer, a power of two
+
+/*********************************************
+ * TRACE
+ * One timeline per run, so everything is
+ * static.  record() belongs to the drawing
+ * thread; the writing happens on a thread of
+ * its own.
+ *********************************************/
+class Trace
+{
+public:
+   // open the file and start the writer.  Returns false if the file
+   // could not be opened
+   static bool start(const char * path);
+
+   // write what is left and close the JSON off
+   static void stop();
+
+   static bool isActive() { return active; }
+
+   // one finished span.  The name must live forever: a string literal
+   static void record(const char * name, long long begin, long long end);
+
+   // spans lost because the ring was full
+   static long long getDropped();
+
+private:
+   static bool active;
+};
+
+/*********************************************
+ * TRACE SPAN
+ * Times the block it lives in.  Costs one test
+ * when tracing is off.
+ *********************************************/
+class TraceSpan
+{
+public:
+   TraceSpan(const char * name) : name(name),
+      begin(Trace::isActive() ? monotonicNow() : 0) {}
+   ~TraceSpan()
+   {
+      if (begin && Trace::isActive())
+         Trace::record(name, begin, monotonicNow());
+   }
+private:
+   const char * name;
+   long long    begin;   // 0 when we are not tracing
+};
+
+#define TRACE_SCOPE_JOIN(a, b) a##b
+#define TRACE_SCOPE_NAME(a, b) TRACE_SCOPE_JOIN(a, b)
+
+/*********************************************
+ * TRACE SCOPE
+ * Put the rest of this block on the timeline:
+ *    TRACE_SCOPE("Game::advance");
+ *********************************************/
+#define TRACE_SCOPE(name) \
+   TraceSpan TRACE_SCOPE_NAME(traceSpan, __LINE__)(name)
+
+#endif // TRACE_H
@@ -16,6 +16,7 @@
 #include <string>     // To display text on the screen
 #include <cmath>      // for M_PI, sin() and cos()
 #include "point.h"    // Where things are drawn
+#include "levelOfDetail.h" // DETAIL_FULL and friends
 using std::string;
 
 /************************************************************************
@@ -37,6 +38,13 @@ void drawNumber(const Point & topLeft, int number);
  ************************************************************************/
 void drawText(const Point & topLeft, const char * text);
 
+/*************************************************************************
+ * DRAW STATIC TEXT
+ * Draw text that never changes.  The first call compiles it into a
+ * display list, so only pass strings that live as long as the program
+ ************************************************************************/
+void drawStaticText(const Point & topLeft, const char * text);
+
 /************************************************************************
  * ROTATE
  * Rotate a given point (point) around a given origin (center) by a given
@@ -96,6 +104,35 @@ void drawLanderFlames(const Point & point,
  *************************************************************************/
 void drawDot(const Point & point);
 
+/************************************************************************
+ * BATCH POINT / DOT / LINE
+ * Like drawing a point, a dot or a line, but the color goes with the
+ * vertices and nothing reaches OpenGL until flushBatches().  Then all the
+ * points go out in one draw and all the lines in another.
+ *************************************************************************/
+void batchPoint(const Point & point, float red, float green, float blue);
+void batchDot(  const Point & point, float red, float green, float blue);
+void batchLine( const Point & begin, const Point & end,
+                float red, float green, float blue);
+void flushBatches();
+
+/************************************************************************
+ * STATE CHANGES
+ * How many color changes and primitives we have sent OpenGL since the
+ * last reset.  A display list counts for whatever it has inside it
+ *************************************************************************/
+int  getStateChanges();
+void resetStateChanges();
+
+/************************************************************************
+ * GET GL PROC / GET GL VERSION
+ * Anything past OpenGL 1.1 has to be asked for by name: NULL when this
+ * platform has no loader.  The version is major * 10 + minor, so 2.1 is
+ * 21, and 0 before there is a context
+ *************************************************************************/
+void * getGLProc(const char * name);
+int    getGLVersion();
+
 /************************************************************************
  * DRAW Sacred Bird
  * Draw the bird on the screen
@@ -108,6 +145,29 @@ void drawSacredBird(const Point & center, float radius);
  *************************************************************************/
 void drawToughBird(const Point & center, float radius, int hits);
 
+/*************************************************************************
+ * MESHES
+ * Shapes built once and then turned and placed for each instance.
+ * drawMesh() draws right away; queueMesh() holds the instance until
+ * flushMeshes(), which draws all the instances of each shape together.
+ * Each shape has MESH_VARIANTS versions: different random colors for the
+ * rocks, different flickers for the flame.
+ ************************************************************************/
+#define MESH_SHIP          0
+#define MESH_FLAME         1
+#define MESH_SACRED_BIRD   2
+#define MESH_SMALL_ROCK    3
+#define MESH_MEDIUM_ROCK   4
+#define MESH_LARGE_ROCK    5
+#define MESH_COUNT         6
+#define MESH_VARIANTS      4
+
+void drawMesh( int mesh, const Point & center, float rotation,
+               int variant = 0, float scale = 1.0);
+void queueMesh(int mesh, const Point & center, float rotation,
+               int variant = 0, float scale = 1.0);
+void flushMeshes();
+
 /************************************************************************      
  * DRAW Ship                                                                   
  * Draw the spaceship on the screen                                         
@@ -116,10 +176,14 @@ void drawShip(const Point & point, int rotation, bool thrust = false);
 
 /**********************************************************************
  * DRAW * ASTEROID
+ * detail is one of DETAIL_FULL, DETAIL_OUTLINE or DETAIL_DOT.  Full
+ * detail is queued and goes on the screen at flushMeshes()
  **********************************************************************/
-void drawSmallAsteroid( const Point & point, int rotation);
-void drawMediumAsteroid(const Point & point, int rotation);
-void drawLargeAsteroid( const Point & point, int rotation);
+void drawAsteroid(int mesh, const Point & point, int rotation,
+                  int detail = DETAIL_FULL);
+void drawSmallAsteroid( const Point & point, int rotation, int detail = DETAIL_FULL);
+void drawMediumAsteroid(const Point & point, int rotation, int detail = DETAIL_FULL);
+void drawLargeAsteroid( const Point & point, int rotation, int detail = DETAIL_FULL);
 
 /******************************************************************
  * RANDOM
@@ -13,7 +13,6 @@
 #include <string>     // need you ask?
 #include <sstream>    // convert an integer into text
 #include <cassert>    // I feel the need... the need for asserts
-#include <time.h>     // for clock
 #include <cstdlib>    // for rand()
 
 
@@ -31,7 +30,6 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <Gl/glut.h>           // OpenGL library we copied
-#include <ctime>            // for ::Sleep();
 #include <Windows.h>
 
 #define _USE_MATH_DEFINES
@@ -39,39 +37,13 @@
 #endif // _WIN32
 
 #include "uiInteract.h"
+#include "frameCapture.h"
+#include "trace.h"
 #include "point.h"
 
 using namespace std;
 
 
-/*********************************************************************
- * SLEEP
- * Pause for a while.  We want to put the program to sleep until it
- * is time to draw again.  Note that this requires us to tell the OS
- * that we are idle.  the nanosleep function performs this task for us
- *   INPUT: msSleep: sleep time in milliseconds
- *********************************************************************/
-void sleep(unsigned long msSleep)
-{
-   // Windows handles sleep one way
-#ifdef _WIN32
-   ::Sleep(msSleep + 35);
-
-   // Unix-based operating systems (OS-X, Linux) do it another
-#else // LINUX, XCODE
-   timespec req = {};
-   time_t sec = (int)(msSleep / 1000);
-   msSleep -= (sec * 1000);
-
-   req.tv_sec = sec;
-   req.tv_nsec = msSleep * 1000000L;
-
-   while (nanosleep(&req, &req) == -1)
-      ;
-#endif // LINUX, XCODE
-   return;
-}
-
 /************************************************************************
  * DRAW CALLBACK
  * This is the main callback from OpenGL. It gets called constantly by
@@ -92,20 +64,30 @@ void drawCallback()
    
    //calls the client's display function
    assert(ui.callBack != NULL);
+   ui.beginWork();
+   ui.processInput();
    ui.callBack(&ui, ui.p);
+   FrameCapture::grab();
+   ui.endWork();
    
    //loop until the timer runs out
-   if (!ui.isTimeToDraw())
-      sleep((unsigned long)((ui.getNextTick() - clock()) / 1000));
+   {
+      TRACE_SCOPE("waitForNextDraw");
+      if (!ui.isTimeToDraw())
+         ui.waitForNextDraw();
+   }
 
    // from this point, set the next draw time
    ui.setNextDrawTime();
 
    // bring forth the background buffer
-   glutSwapBuffers();
+   {
+      TRACE_SCOPE("glutSwapBuffers");
+      glutSwapBuffers();
+   }
 
-   // clear the space at the end
-   ui.keyEvent();
+   // the keys handled this frame are now on the screen
+   ui.recordPresent();
 }
 
 /************************************************************************
@@ -120,7 +102,7 @@ void keyDownCallback(int key, int x, int y)
    // Even though this is a local variable, all the members are static
    // so we are actually getting the same version as in the constructor.
    Interface ui;
-   ui.keyEvent(key, true /*fDown*/);
+   ui.postKeyEvent(key, true /*fDown*/);
 }
 
 /************************************************************************
@@ -134,7 +116,7 @@ void keyUpCallback(int key, int x, int y)
    // Even though this is a local variable, all the members are static
    // so we are actually getting the same version as in the constructor.
    Interface ui;
-   ui.keyEvent(key, false /*fDown*/);
+   ui.postKeyEvent(key, false /*fDown*/);
 }
 
 /***************************************************************
@@ -147,7 +129,7 @@ void keyboardCallback(unsigned char key, int x, int y)
    // Even though this is a local variable, all the members are static
    // so we are actually getting the same version as in the constructor.
    Interface ui;
-   ui.keyEvent(key, true /*fDown*/);
+   ui.postKeyEvent(key, true /*fDown*/);
 }
 
 /***************************************************************
@@ -183,9 +165,8 @@ void Interface::keyEvent(int key, bool fDown)
 }
 /***************************************************************
  * INTERFACE : KEY EVENT
- * Either set the up or down event for a given key
- *   INPUT   key     which key is pressed
- *           fDown   down or brown
+ * A new tick is starting.  Keys that are still held count one more
+ * frame and the one-shot keys are cleared.
  ****************************************************************/
 void Interface::keyEvent()
 {
@@ -201,6 +182,88 @@ void Interface::keyEvent()
    isSpacePress = false;
 }
 
+/***************************************************************
+ * KEY BIT
+ * Which bit in a mask stands for this key.  Zero for keys we
+ * do not care about.
+ ****************************************************************/
+static int keyBit(int key)
+{
+   switch(key)
+   {
+      case GLUT_KEY_DOWN:  return 0x01;
+      case GLUT_KEY_UP:    return 0x02;
+      case GLUT_KEY_RIGHT: return 0x04;
+      case GLUT_KEY_LEFT:  return 0x08;
+      case 'r':            return 0x10;
+      case GLUT_KEY_HOME:
+      case ' ':            return 0x20;
+   }
+   return 0x00;
+}
+
+/***************************************************************
+ * INTERFACE : POST KEY EVENT
+ * Called from the GLUT callbacks.  Stamp the transition with the
+ * time and queue it for the start of the next tick.
+ *   INPUT   key     which key is pressed
+ *           fDown   down or up
+ ****************************************************************/
+void Interface::postKeyEvent(int key, bool fDown)
+{
+   InputEvent event;
+   event.key       = key;
+   event.fDown     = fDown;
+   event.timestamp = monotonicNow();
+   inputQueue.push(event);
+}
+
+/***************************************************************
+ * INTERFACE : PROCESS INPUT
+ * Drain the queued key transitions into the key state for this
+ * tick.  Each key may change only once per tick: a second change
+ * stays in the queue for the next tick.  That way a tap shorter
+ * than a frame is still seen for one whole frame, and two quick
+ * taps are seen as two presses rather than one.
+ ****************************************************************/
+void Interface::processInput()
+{
+   long long now = monotonicNow();
+
+   // held keys count up, one-shot keys are cleared
+   keyEvent();
+
+   consumedCount = 0;
+   int changed = 0;
+   InputEvent event;
+   while (inputQueue.peek(event))
+   {
+      int bit = keyBit(event.key);
+      if (bit & changed)
+         break;
+      changed |= bit;
+      inputQueue.pop();
+
+      keyEvent(event.key, event.fDown);
+      inputToSimulation.record(now - event.timestamp);
+      if (consumedCount < INPUT_LATENCY_SAMPLES)
+         consumed[consumedCount++] = event.timestamp;
+   }
+}
+
+/***************************************************************
+ * INTERFACE : RECORD PRESENT
+ * The buffers were just swapped.  Every key handled this tick
+ * has now made it to the screen, or at least to the driver.
+ ****************************************************************/
+void Interface::recordPresent()
+{
+   long long now = monotonicNow();
+   for (int i = 0; i < consumedCount; i++)
+      inputToPhoton.record(now - consumed[i]);
+   consumedCount = 0;
+}
+
 
 /************************************************************************
  * INTEFACE : IS TIME TO DRAW
@@ -209,17 +272,17 @@ void Interface::keyEvent()
  *************************************************************************/
 bool Interface::isTimeToDraw()
 {
-   return ((unsigned int)clock() >= nextTick);
+   return pacer.isTimeToDraw();
 }
 
 /************************************************************************
  * INTERFACE : SET NEXT DRAW TIME
  * What time should we draw the buffer again?  This is a function of
- * the current time and the frames per second.
+ * the last deadline and the frames per second, so we do not drift.
  *************************************************************************/
 void Interface::setNextDrawTime()
 {
-   nextTick = clock() + static_cast<int> (timePeriod * CLOCKS_PER_SEC);
+   pacer.setNextDrawTime();
 }
 
 /************************************************************************
@@ -232,6 +295,7 @@ void Interface::setNextDrawTime()
 void Interface::setFramesPerSecond(double value)
 {
     timePeriod = (1 / value);
+    pacer.setFramesPerSecond(value);
 }
 
 /***************************************************
@@ -247,7 +311,12 @@ int			 Interface::isRPress = false;
 bool         Interface::isSpacePress = false;
 bool         Interface::initialized  = false;
 double       Interface::timePeriod   = 1.0 / 30; // default to 30 frames/second
-unsigned int Interface::nextTick     = 0;        // redraw now please
+FramePacer   Interface::pacer;                   // redraw now please
+InputQueue   Interface::inputQueue;
+FrameHistogram Interface::inputToSimulation;
+FrameHistogram Interface::inputToPhoton;
+long long    Interface::consumed[INPUT_LATENCY_SAMPLES];
+int          Interface::consumedCount = 0;
 void *       Interface::p            = NULL;
 void (*Interface::callBack)(const Interface *, void *) = NULL;
 
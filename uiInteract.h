@@ -18,6 +18,10 @@
 #define UI_INTERFACE_H
 
  #include "point.h"
+ #include "frameTimer.h"
+ #include "inputQueue.h"
+
+#define INPUT_LATENCY_SAMPLES 16   // key events per frame we time to the screen
 
 /********************************************
  * INTERFACE
@@ -50,17 +54,42 @@ public:
    // Set the next draw time based on current time and time period
    void setNextDrawTime();
 
+   // Sleep, then spin, until it is time to draw
+   void waitForNextDraw() const { pacer.wait(); }
+
    // Retrieve the next tick time... the time of the next draw.
-   unsigned int getNextTick() { return nextTick; };
+   long long getNextTick() const { return pacer.getNextTick(); };
 
    // How many frames per second are we configured for?
    void setFramesPerSecond(double value);
+
+   // Bracket the client's work so we know how busy each frame is
+   void beginWork() { pacer.beginWork(); }
+   void endWork()   { pacer.endWork();   }
+
+   // How steady have we been?  Intervals between frames and time
+   // spent in the client callback, both in nanoseconds
+   const FrameHistogram & getFrameTimes() const { return pacer.getFrameTimes(); }
+   const FrameHistogram & getWorkTimes()  const { return pacer.getWorkTimes();  }
+   long long getRecentFrameTime() const { return pacer.getRecentFrameTime(); }
+   long long getLastWorkTime()    const { return pacer.getLastWorkTime();    }
    
    // Key event indicating a key has been pressed or not.  The callbacks
    // should be the only onces to call this
+   void postKeyEvent(int key, bool fDown);
    void keyEvent(int key, bool fDown);
    void keyEvent();
 
+   // Drain the queued key events at the start of a tick, and note
+   // when the frame that handled them was presented
+   void processInput();
+   void recordPresent();
+
+   // How long key events waited before the simulation saw them, and
+   // before the frame that handled them was swapped to the screen
+   static const FrameHistogram & getInputToSimulation() { return inputToSimulation; }
+   static const FrameHistogram & getInputToPhoton()     { return inputToPhoton;     }
+
    // Current frame rate
    double frameRate() const { return timePeriod;   };
    
@@ -80,7 +109,13 @@ private:
 
    static bool         initialized;  // only run the constructor once!
    static double       timePeriod;   // interval between frame draws
-   static unsigned int nextTick;     // time (from clock()) of our next draw
+   static FramePacer   pacer;        // decides when the next draw is
+
+   static InputQueue     inputQueue;        // key events from the callbacks
+   static FrameHistogram inputToSimulation; // event to start of tick
+   static FrameHistogram inputToPhoton;     // event to buffer swap
+   static long long      consumed[INPUT_LATENCY_SAMPLES]; // handled this tick
+   static int            consumedCount;
 
    static int  isDownPress;          // is the down arrow currently pressed?
    static int  isUpPress;            //    "   up         "
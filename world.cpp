@@ -0,0 +1,119 @@
+/***********************************************************************
+ * Source File:
+ *    World : the edges of space
+ * Summary:
+ *    The bounds of the arena and the wrapping rules that the ship, the
+ *    bullets and the rocks all share.
+ ************************************************************************/
+
+#include <cassert>    // I feel the need... the need for asserts
+#include "world.h"
+#include "uiDraw.h"   // for random()
+#include "simRandom.h"
+
+float World::xMin = -WORLD_DEFAULT_SIZE;
+float World::xMax =  WORLD_DEFAULT_SIZE;
+float World::yMin = -WORLD_DEFAULT_SIZE;
+float World::yMax =  WORLD_DEFAULT_SIZE;
+
+/******************************************************************
+ * WORLD : SET BOUNDS
+ *   INPUT  topLeft       the upper left corner of the arena
+ *          bottomRight   the lower right corner
+ ****************************************************************/
+void World::setBounds(const Point & topLeft, const Point & bottomRight)
+{
+   assert(topLeft.getX() < bottomRight.getX());
+   assert(bottomRight.getY() < topLeft.getY());
+
+   xMin = topLeft.getX();
+   xMax = bottomRight.getX();
+   yMin = bottomRight.getY();
+   yMax = topLeft.getY();
+}
+
+/******************************************************************
+ * WORLD : SET SIZE
+ * An arena centered on the origin
+ *   INPUT  halfWidth, halfHeight   distance from the center to the edge
+ ****************************************************************/
+void World::setSize(float halfWidth, float halfHeight)
+{
+   setBounds(Point(-halfWidth, halfHeight), Point(halfWidth, -halfHeight));
+}
+
+/******************************************************************
+ * WORLD : GET RANDOM POINT
+ * Gets a random point within the boundaries of the world.
+ ****************************************************************/
+Point World::getRandomPoint()
+{
+   int x = random((int)xMin, (int)xMax);
+   int y = random((int)yMin, (int)yMax);
+   return Point(x, y);
+}
+
+/******************************************************************
+ * WORLD : GET SPAWN POINT
+ * A random point within the world, drawn from SimRandom so two
+ * games seeded alike put things in the same places.
+ ****************************************************************/
+Point World::getSpawnPoint()
+{
+   int x = SimRandom::next((int)xMin, (int)xMax);
+   int y = SimRandom::next((int)yMin, (int)yMax);
+   return Point(x, y);
+}
+
+/******************************************************************
+ * WORLD : IS OUTSIDE
+ * Is the point more than margin past any edge?
+ ****************************************************************/
+bool World::isOutside(const Point & pt, float margin)
+{
+   return pt.getX() < xMin - margin || pt.getX() > xMax + margin ||
+          pt.getY() < yMin - margin || pt.getY() > yMax + margin;
+}
+
+/******************************************************************
+ * WORLD : WRAP X
+ * Something that flies off the left comes back on the right, and
+ * the other way around.
+ *   INPUT  x        the horizontal position
+ *          margin   how far past the edge before we wrap
+ *   OUTPUT x        the wrapped position
+ *          <return> did we wrap?
+ ****************************************************************/
+bool World::wrapX(float & x, float margin)
+{
+   if (x < xMin - margin)
+   {
+      x = xMax + margin;
+      return true;
+   }
+   if (x > xMax + margin)
+   {
+      x = xMin - margin;
+      return true;
+   }
+   return false;
+}
+
+/******************************************************************
+ * WORLD : WRAP Y
+ * Same as wrapX() but for the bottom and top
+ ****************************************************************/
+bool World::wrapY(float & y, float margin)
+{
+   if (y < yMin - margin)
+   {
+      y = yMax + margin;
+      return true;
+   }
+   if (y > yMax + margin)
+   {
+      y = yMin - margin;
+      return true;
+   }
+   return false;
+}
@@ -0,0 +1,58 @@
+/***********************************************************************
+ * Header File:
+ *    World : the edges of space
+ * Summary:
+ *    The one place that knows how big the arena is.  Anything that needs
+ *    to know where the edge is, or how to wrap around it, asks here.  The
+ *    bounds are set once at startup and can be as large as we like; they
+ *    have nothing to do with the size of the window.
+ ************************************************************************/
+
+#ifndef WORLD_H
+#define WORLD_H
+
+#include "point.h"
+
+#define WORLD_DEFAULT_SIZE 200   // half the width of the classic arena
+
+/*********************************************
+ * WORLD
+ * The bounds of the arena and the wrapping rules
+ *********************************************/
+class World
+{
+public:
+   // set the bounds from two corners or from a half-width and half-height
+   static void setBounds(const Point & topLeft, const Point & bottomRight);
+   static void setSize(float halfWidth, float halfHeight);
+
+   static float getXMin()   { return xMin; }
+   static float getXMax()   { return xMax; }
+   static float getYMin()   { return yMin; }
+   static float getYMax()   { return yMax; }
+   static float getWidth()  { return xMax - xMin; }
+   static float getHeight() { return yMax - yMin; }
+
+   // a random spot somewhere in the world, for eye candy
+   static Point getRandomPoint();
+
+   // the same, from the simulation's own numbers, for anything that
+   // changes how the game plays out
+   static Point getSpawnPoint();
+
+   // is the point past the edge by more than the margin?
+   static bool isOutside(const Point & pt, float margin = 0.0);
+
+   // if the coordinate is past the edge by more than the margin, move it
+   // to just past the opposite edge.  Returns true if it wrapped
+   static bool wrapX(float & x, float margin = 0.0);
+   static bool wrapY(float & y, float margin = 0.0);
+
+private:
+   static float xMin;
+   static float xMax;
+   static float yMin;
+   static float yMax;
+};
+
+#endif // WORLD_H